@@ -0,0 +1,185 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef ALARM_H_
+#define ALARM_H_
+
+/** @file alarm.h
+ ** @brief Declaraciones del módulo de alarmas multiples del reloj.
+ **
+ ** El modulo mantiene precalculada la proxima alarma a sonar, de manera que el control que se hace en cada minuto es
+ ** una sola comparacion sin importar cuantas alarmas esten configuradas. La proxima alarma solo se recalcula cuando una
+ ** alarma suena, se pospone o se modifica. El modulo no depende del hardware: el tiempo avanza con AlarmsNewMinute y el
+ ** sonido se maneja a traves de un driver.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define ALARM_SUNDAY    (1 << 0)
+#define ALARM_MONDAY    (1 << 1)
+#define ALARM_TUESDAY   (1 << 2)
+#define ALARM_WEDNESDAY (1 << 3)
+#define ALARM_THURSDAY  (1 << 4)
+#define ALARM_FRIDAY    (1 << 5)
+#define ALARM_SATURDAY  (1 << 6)
+#define ALARM_WEEKDAYS  (ALARM_MONDAY | ALARM_TUESDAY | ALARM_WEDNESDAY | ALARM_THURSDAY | ALARM_FRIDAY)
+#define ALARM_EVERY_DAY (ALARM_WEEKDAYS | ALARM_SATURDAY | ALARM_SUNDAY)
+
+//! Valor devuelto cuando no hay ninguna alarma que cumpla la condicion consultada
+#define ALARM_NONE      0xFF
+
+/* === Public data type declarations =============================================================================== */
+
+//! Estructura que representa el conjunto de alarmas del reloj.
+typedef struct alarms_s * alarms_t;
+
+//! Configuracion de una alarma
+typedef struct alarm_config_s {
+    uint8_t time[4];  //!< Hora de la alarma en digitos BCD (HHMM), con el mismo formato que clock_time_t
+    uint8_t weekdays; //!< Mascara de dias de la semana en que suena la alarma
+    bool recurring;   //!< true si la alarma se repite, false si se desactiva luego de sonar una vez
+    bool enabled;     //!< true si la alarma esta habilitada
+} alarm_config_t;
+
+typedef void (*alarm_turn_on_t)(uint8_t alarm);
+typedef void (*alarm_turn_off_t)(void);
+// Estructura que representa el driver del sonido de las alarmas.
+// Contiene punteros a las funciones que encienden y apagan el aviso sonoro.
+typedef struct alarm_driver_s {
+    alarm_turn_on_t AlarmTurnOn;
+    alarm_turn_off_t AlarmTurnOff;
+} const * alarm_driver_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea el conjunto de alarmas.
+ *
+ * @param driver Puntero a la estructura de driver del sonido de las alarmas.
+ * @param snooze_minutes Minutos que se pospone una alarma con AlarmsSnooze.
+ * @return alarms_t Puntero a la instancia creada, con todas las alarmas deshabilitadas.
+ * @note El tiempo de las alarmas arranca el domingo a las 00:00, se debe sincronizar con AlarmsSetTime.
+ */
+alarms_t AlarmsCreate(alarm_driver_t driver, uint8_t snooze_minutes);
+
+/**
+ * @brief Configura una alarma.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @param index Numero de alarma, entre 0 y ALARM_MAX_COUNT - 1.
+ * @param config Configuracion de la alarma.
+ * @return int 0 si la alarma se configuro, -1 si el numero de alarma o la hora no son validos.
+ */
+int AlarmsSet(alarms_t self, uint8_t index, const alarm_config_t * config);
+
+/**
+ * @brief Obtiene la configuracion de una alarma.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @param index Numero de alarma, entre 0 y ALARM_MAX_COUNT - 1.
+ * @param config Estructura donde se copia la configuracion de la alarma.
+ * @return int 0 si la configuracion se copio, -1 si el numero de alarma no es valido.
+ */
+int AlarmsGet(alarms_t self, uint8_t index, alarm_config_t * config);
+
+/**
+ * @brief Habilita o deshabilita una alarma sin cambiar el resto de su configuracion.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @param index Numero de alarma, entre 0 y ALARM_MAX_COUNT - 1.
+ * @param enabled true para habilitar la alarma, false para deshabilitarla.
+ * @return int 0 si la alarma se modifico, -1 si el numero de alarma no es valido.
+ */
+int AlarmsEnable(alarms_t self, uint8_t index, bool enabled);
+
+/**
+ * @brief Sincroniza el tiempo de las alarmas con la hora del reloj.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @param weekday Dia de la semana, 0 es domingo y 6 es sabado.
+ * @param time Hora actual en digitos BCD (HHMM).
+ */
+void AlarmsSetTime(alarms_t self, uint8_t weekday, const uint8_t time[4]);
+
+/**
+ * @brief Informa que transcurrio un minuto y controla si corresponde hacer sonar una alarma.
+ *
+ * Esta funcion solo compara el tiempo actual con el de la proxima alarma precalculada. Todas las alarmas que vencen en
+ * el mismo minuto suenan juntas, AlarmsRinging devuelve la de menor numero y AlarmsSnooze o AlarmsStop las afectan a
+ * todas.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @return bool true si en este minuto empezo a sonar una alarma.
+ */
+bool AlarmsNewMinute(alarms_t self);
+
+/**
+ * @brief Pospone las alarmas que estan sonando.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ */
+void AlarmsSnooze(alarms_t self);
+
+/**
+ * @brief Apaga la alarma que esta sonando y cancela cualquier alarma pospuesta.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ */
+void AlarmsStop(alarms_t self);
+
+/**
+ * @brief Indica que alarma esta sonando.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @return uint8_t Numero de la alarma que esta sonando o ALARM_NONE si no suena ninguna.
+ */
+uint8_t AlarmsRinging(alarms_t self);
+
+/**
+ * @brief Indica cual es la proxima alarma que va a sonar.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @param minutes Si no es NULL, se devuelve la cantidad de minutos que faltan para que suene.
+ * @return uint8_t Numero de la proxima alarma o ALARM_NONE si no hay alarmas pendientes.
+ */
+uint8_t AlarmsNext(alarms_t self, uint16_t * minutes);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ALARM_H_ */
@@ -41,11 +41,32 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+#include "buzzer.h"
+#include "clock.h"
 #include "digital.h"
+#include "pps.h"
 #include "screen.h"
+#include "storage.h"
+
+//! Interrupcion del timer que captura los pulsos de referencia
+#define BOARD_REFERENCE_IRQn       TIMER2_IRQn
+
+//! Rutina de interrupcion de la captura de los pulsos de referencia, la define la aplicacion
+#define BOARD_REFERENCE_IRQHandler TIMER2_IRQHandler
 
 /* === Public data type declarations =============================================================================== */
 
+//! Identificadores de las teclas de la placa, en el mismo orden en que aparecen en Board_s
+typedef enum board_key_e {
+    BOARD_KEY_SET_TIME,
+    BOARD_KEY_SET_ALARM,
+    BOARD_KEY_DECREMENT,
+    BOARD_KEY_INCREMENT,
+    BOARD_KEY_ACCEPT,
+    BOARD_KEY_CANCEL,
+    BOARD_KEYS_COUNT,
+} board_key_t;
+
 //! Estructura que representa las entradas y salidas digitales de la placa.
 
 typedef struct Board_s {
@@ -54,13 +75,18 @@ typedef struct Board_s {
     digital_output_t green_led;
     digital_output_t blue_led;
 
-    digital_input_t set_time;  // Tecla F4
-    digital_input_t set_alarm; // Tecla F3
-    digital_input_t decrement; // Tecla F2
-    digital_input_t increment; // Tecla F1
-    digital_input_t accept;    // Tecla de aceptar
-    digital_input_t cancel;    // Tecla de cancelar
-    screen_t screen;           // Puntero a la pantalla
+    digital_input_t set_time;       // Tecla F4
+    digital_input_t set_alarm;      // Tecla F3
+    digital_input_t decrement;      // Tecla F2
+    digital_input_t increment;      // Tecla F1
+    digital_input_t accept;         // Tecla de aceptar
+    digital_input_t cancel;         // Tecla de cancelar
+    digital_input_group_t keys;     // Grupo con todas las teclas, NULL si se atienden por interrupcion
+    screen_t screen;                // Puntero a la pantalla
+    buzzer_driver_t tone;           // Driver que genera los tonos del zumbador para el secuenciador
+    storage_driver_t eeprom;        // Driver de la EEPROM interna para guardar la configuracion
+    clock_rtc_driver_t rtc;         // Driver del RTC que lleva la hora, NULL si la hora se cuenta con el SysTick
+    pps_capture_driver_t reference; // Driver de la captura de los pulsos de referencia, NULL si no se usan
 } const * Board_t;
 
 /* === Public variable declarations ================================================================================ */
@@ -70,7 +96,10 @@ typedef struct Board_s {
 /**
  * @brief Inicializa (crea) la placa.
  *
- * @return Board_t Puntero a la instancia de la placa creada.
+ * La placa, sus entradas, salidas y pantalla se toman de la memoria de cada modulo, que con USE_STATIC_MEMORY esta
+ * dimensionada en tiempo de compilacion en config.h.
+ *
+ * @return Board_t Puntero a la instancia de la placa creada, NULL con USE_STATIC_MEMORY si ya se habia creado.
  * @note Esta funcion debe ser llamada una sola vez al inicio de la aplicacion.
  */
 
@@ -0,0 +1,125 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef BUZZER_H_
+#define BUZZER_H_
+
+/** @file buzzer.h
+ ** @brief Declaraciones del módulo secuenciador de tonos del zumbador.
+ **
+ ** El secuenciador reproduce melodias formadas por notas y silencios. La onda cuadrada de cada nota la genera el
+ ** hardware a traves de un driver, y el paso de una nota a la siguiente lo marca una unica tarea del planificador, por
+ ** lo que reproducir una melodia no demora el lazo principal ni el refresco de la pantalla. Una melodia es una lista
+ ** de patrones que se repiten una cantidad de veces cada uno, lo que permite sonidos que se intensifican, como el de
+ ** una alarma que sigue sonando.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "scheduler.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+typedef void (*buzzer_tone_start_t)(uint16_t frequency);
+typedef void (*buzzer_tone_stop_t)(void);
+// Estructura que representa el driver del zumbador.
+// ToneStart genera una onda cuadrada de la frecuencia indicada en hertz hasta que se llama a ToneStop, una nueva
+// llamada cambia la frecuencia sin detener el sonido.
+typedef struct buzzer_driver_s {
+    buzzer_tone_start_t ToneStart;
+    buzzer_tone_stop_t ToneStop;
+} const * buzzer_driver_t;
+
+//! Nota de una melodia
+typedef struct buzzer_note_s {
+    uint16_t frequency; //!< Frecuencia en hertz, 0 para un silencio
+    uint16_t duration;  //!< Duracion en milisegundos
+} buzzer_note_t;
+
+//! Patron de notas que se repite dentro de una melodia
+typedef struct buzzer_pattern_s {
+    const buzzer_note_t * notes; //!< Notas del patron
+    uint8_t count;               //!< Cantidad de notas del patron
+    uint8_t repeats;             //!< Veces que se reproduce el patron, 0 para repetirlo hasta que se detenga la melodia
+} buzzer_pattern_t;
+
+//! Estructura que representa el secuenciador del zumbador.
+typedef struct buzzer_s * buzzer_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea el secuenciador del zumbador, hay una sola instancia.
+ *
+ * @param scheduler Planificador del que se toma la tarea que avanza las notas.
+ * @param driver Puntero al driver del zumbador.
+ * @return buzzer_t Puntero al secuenciador o NULL si no se pudo crear.
+ */
+buzzer_t BuzzerCreate(scheduler_t scheduler, buzzer_driver_t driver);
+
+/**
+ * @brief Empieza a reproducir una melodia, reemplazando la que estuviera sonando si no tiene mas prioridad.
+ *
+ * Los patrones y sus notas no se copian, deben existir mientras suena la melodia.
+ *
+ * @param self Puntero al secuenciador.
+ * @param patterns Patrones de la melodia, se reproducen en orden.
+ * @param count Cantidad de patrones.
+ * @param priority Prioridad de la melodia, una melodia no interrumpe a otra de mayor prioridad.
+ * @return int 0 si la melodia empezo a sonar, -1 si los parametros no son validos o suena otra mas prioritaria.
+ */
+int BuzzerPlay(buzzer_t self, const buzzer_pattern_t patterns[], uint8_t count, uint8_t priority);
+
+/**
+ * @brief Detiene la melodia que esta sonando, sin importar su prioridad.
+ *
+ * @param self Puntero al secuenciador.
+ */
+void BuzzerStop(buzzer_t self);
+
+/**
+ * @brief Indica si hay una melodia sonando.
+ *
+ * @param self Puntero al secuenciador.
+ * @return bool true si hay una melodia en curso, aunque este en un silencio.
+ */
+bool BuzzerIsPlaying(buzzer_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BUZZER_H_ */
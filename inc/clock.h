@@ -0,0 +1,194 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+/** @file clock.h
+ ** @brief Declaraciones del módulo reloj de tiempo real en formato BCD.
+ **
+ ** La hora se guarda como un vector de digitos BCD con el mismo formato que consume ScreenWriteBCD, de manera que el
+ ** avance de cada segundo se resuelve con incrementos y acarreos entre digitos, sin divisiones.
+ **
+ ** La base de tiempo puede ser un contador de ticks, que avanza la hora con ClockNewTick, o un reloj de tiempo real por
+ ** hardware que interrumpe una vez por segundo y llama a ClockNewSecond. Con el RTC el procesador no hace nada entre
+ ** segundos, la hora no acumula el error de la frecuencia del tick y se conserva durante un reinicio. Con el contador
+ ** de ticks el error de frecuencia, si se conoce, se corrige con ClockSetCorrection.
+ **
+ ** El reloj tambien lleva el dia de la semana, que avanza a medianoche y que usan las alarmas para sus mascaras de
+ ** dias.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de digitos BCD que forman la hora completa (HH:MM:SS)
+#define CLOCK_DIGITS 6
+
+//! Cantidad de dias de la semana, numerados desde 0 el domingo como en las mascaras de las alarmas
+#define CLOCK_WEEKDAYS 7
+
+/* === Public data type declarations =============================================================================== */
+
+//! Hora del reloj, accesible como vector de digitos BCD o por campos
+typedef union clock_time_u {
+    struct {
+        uint8_t hours[2];   //!< Decenas y unidades de las horas
+        uint8_t minutes[2]; //!< Decenas y unidades de los minutos
+        uint8_t seconds[2]; //!< Decenas y unidades de los segundos
+    } time;
+    uint8_t bcd[CLOCK_DIGITS]; //!< Digitos en el orden en que se muestran, de izquierda a derecha
+} clock_time_t;
+
+//! Estructura que representa un reloj de tiempo real.
+typedef struct clock_s * clock_bcd_t;
+
+//! Funciones de un reloj de tiempo real por hardware que lleva la hora en lugar del contador de ticks
+typedef struct clock_rtc_driver_s {
+    bool (*GetTime)(clock_time_t * time, uint8_t * weekday); //!< Lee la hora y el dia, false si no se configuro
+    void (*SetTime)(const clock_time_t * time);              //!< Configura la hora y reinicia la fraccion de segundo
+    void (*SetWeekday)(uint8_t weekday);                     //!< Configura el dia de la semana sin tocar la hora
+    void (*Acknowledge)(void);                               //!< Borra el pedido de la interrupcion de cada segundo
+} const * clock_rtc_driver_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un reloj de tiempo real.
+ *
+ * @param ticks_per_second Cantidad de llamadas a ClockNewTick que forman un segundo.
+ * @param rtc Driver del RTC que lleva la hora, NULL para contar los ticks.
+ * @return clock_bcd_t Puntero a la instancia del reloj creado.
+ * @note El reloj arranca con la hora y el dia que conserva el RTC, o el domingo a las 00:00:00 y con la hora marcada
+ * como invalida hasta que se llame a ClockSetTime.
+ */
+clock_bcd_t ClockCreate(uint16_t ticks_per_second, clock_rtc_driver_t rtc);
+
+/**
+ * @brief Obtiene la hora actual del reloj.
+ *
+ * @param self Puntero al objeto reloj.
+ * @param result Estructura donde se copia la hora actual.
+ * @return bool true si la hora es valida, false si todavia no fue configurada.
+ */
+bool ClockGetTime(clock_bcd_t self, clock_time_t * result);
+
+/**
+ * @brief Configura la hora del reloj.
+ *
+ * @param self Puntero al objeto reloj.
+ * @param new_time Hora a configurar, cada digito debe estar dentro del rango que le corresponde.
+ * @return bool true si la hora se configuro, false si la hora recibida no es valida.
+ * @note Al configurar la hora se reinicia la fraccion de segundo en curso.
+ */
+bool ClockSetTime(clock_bcd_t self, const clock_time_t * new_time);
+
+/**
+ * @brief Obtiene el dia de la semana del reloj.
+ *
+ * @param self Puntero al objeto reloj.
+ * @return uint8_t Dia de la semana, 0 es domingo y 6 es sabado.
+ */
+uint8_t ClockGetWeekday(clock_bcd_t self);
+
+/**
+ * @brief Configura el dia de la semana del reloj, sin cambiar la hora ni la fraccion de segundo en curso.
+ *
+ * @param self Puntero al objeto reloj.
+ * @param weekday Dia de la semana, 0 es domingo y 6 es sabado.
+ * @return bool true si el dia se configuro, false si no es valido.
+ */
+bool ClockSetWeekday(clock_bcd_t self, uint8_t weekday);
+
+/**
+ * @brief Corrige el error de frecuencia de la base de tiempo de ticks.
+ *
+ * Un acumulador de fase suma en cada tick la fraccion de tick que hay que corregir y, cuando desborda, ese tick se
+ * descarta o se cuenta doble. El error se reparte en correcciones de un tick en lugar de saltos de un segundo.
+ *
+ * @param self Puntero al objeto reloj.
+ * @param ppb Error de la frecuencia del tick en partes por mil millones, positivo si los ticks son mas rapidos que lo
+ * nominal, entre -500000000 y 500000000. No tiene efecto si la hora la lleva el RTC.
+ */
+void ClockSetCorrection(clock_bcd_t self, int32_t ppb);
+
+/**
+ * @brief Indica cuantos ticks faltan para completar el segundo en curso.
+ *
+ * @param self Puntero al objeto reloj.
+ * @return uint16_t Cantidad de llamadas a ClockNewTick hasta la que completa el segundo, UINT16_MAX si la hora la
+ * lleva el RTC y no hace falta ningun tick. Con la correccion de frecuencia el segundo nunca se completa antes, pero
+ * puede completarse un tick despues.
+ */
+uint16_t ClockTicksToNextSecond(clock_bcd_t self);
+
+/**
+ * @brief Informa al reloj que transcurrio un tick de su base de tiempo.
+ *
+ * Esta funcion esta pensada para ser llamada desde una rutina de interrupcion periodica.
+ *
+ * @param self Puntero al objeto reloj.
+ * @return bool true si con este tick se completo un segundo y la hora avanzo, siempre false si la hora la lleva el
+ * RTC.
+ */
+bool ClockNewTick(clock_bcd_t self);
+
+/**
+ * @brief Informa al reloj que el RTC completo un segundo y copia la hora del RTC.
+ *
+ * Esta funcion esta pensada para ser llamada desde la rutina de interrupcion del RTC.
+ *
+ * @param self Puntero al objeto reloj.
+ * @return bool true si la hora avanzo, false si el reloj no tiene RTC.
+ */
+bool ClockNewSecond(clock_bcd_t self);
+
+/**
+ * @brief Muestra las horas y los minutos actuales en una pantalla.
+ *
+ * Los digitos se entregan directamente a ScreenWriteBCD sin ninguna conversion.
+ *
+ * @param self Puntero al objeto reloj.
+ * @param screen Puntero al objeto pantalla.
+ */
+void ClockDisplay(clock_bcd_t self, screen_t screen);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,310 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CONFIG_H_
+#define CONFIG_H_
+
+/** @file config.h
+ ** @brief Parametros de configuracion de la aplicacion y de las bibliotecas.
+ **
+ ** Todos los valores se pueden redefinir desde la linea de comandos del compilador.
+ **/
+
+/* === Public macros definitions =================================================================================== */
+
+//! Si es distinto de cero los objetos se toman de arreglos estaticos del tamaño indicado abajo, sin usar el heap.
+#ifndef USE_STATIC_MEMORY
+#define USE_STATIC_MEMORY 1
+#endif
+
+//! Cantidad de salidas digitales disponibles con memoria estatica.
+#ifndef DIGITAL_OUTPUT_INSTANCES
+#define DIGITAL_OUTPUT_INSTANCES 4
+#endif
+
+//! Cantidad de entradas digitales disponibles con memoria estatica.
+#ifndef DIGITAL_INPUT_INSTANCES
+#define DIGITAL_INPUT_INSTANCES 6
+#endif
+
+//! Cantidad de grupos de entradas digitales disponibles con memoria estatica.
+#ifndef DIGITAL_GROUP_INSTANCES
+#define DIGITAL_GROUP_INSTANCES 1
+#endif
+
+//! Cantidad de pantallas disponibles con memoria estatica.
+#ifndef SCREEN_INSTANCES
+#define SCREEN_INSTANCES 1
+#endif
+
+//! Cantidad maxima de digitos de un texto que se desplaza por la pantalla.
+#ifndef SCREEN_MARQUEE_SIZE
+#define SCREEN_MARQUEE_SIZE 32
+#endif
+
+//! Cantidad maxima de pantallas que se refrescan juntas con el servicio de refresco.
+#ifndef SCREEN_SERVICE_SCREENS
+#define SCREEN_SERVICE_SCREENS 2
+#endif
+
+//! Cantidad de relojes disponibles con memoria estatica.
+#ifndef CLOCK_INSTANCES
+#define CLOCK_INSTANCES 1
+#endif
+
+//! Cantidad de conjuntos de alarmas disponibles con memoria estatica.
+#ifndef ALARMS_INSTANCES
+#define ALARMS_INSTANCES 1
+#endif
+
+//! Frecuencia de la interrupcion del SysTick. En cada interrupcion se refresca un digito de la pantalla.
+#ifndef SYSTICK_RATE_HZ
+#define SYSTICK_RATE_HZ 1000
+#endif
+
+//! Periodo de parpadeo del led verde, en milisegundos.
+#ifndef HEARTBEAT_PERIOD_MS
+#define HEARTBEAT_PERIOD_MS 500
+#endif
+
+//! Cantidad maxima de alarmas que se pueden configurar.
+#ifndef ALARM_MAX_COUNT
+#define ALARM_MAX_COUNT 4
+#endif
+
+//! Minutos que se pospone una alarma al presionar la tecla de posponer.
+#ifndef ALARM_SNOOZE_MINUTES
+#define ALARM_SNOOZE_MINUTES 5
+#endif
+
+//! Barridos de la pantalla que dura cada mitad del parpadeo de los digitos que se configuran o de la alarma.
+#ifndef UI_FLASH_SCANS
+#define UI_FLASH_SCANS 50
+#endif
+
+//! Segundos sin presionar teclas luego de los que se abandona la configuracion de la hora o de la alarma.
+#ifndef UI_TIMEOUT_SECONDS
+#define UI_TIMEOUT_SECONDS 30
+#endif
+
+//! Tiempo entre dos pasos de un mensaje que se desplaza por la pantalla, en milisegundos.
+#ifndef UI_SCROLL_STEP_MS
+#define UI_SCROLL_STEP_MS 300
+#endif
+
+//! Segundos que suena una alarma que nadie atiende antes de apagarse sola hasta el dia siguiente.
+#ifndef UI_RING_TIMEOUT_SECONDS
+#define UI_RING_TIMEOUT_SECONDS 300
+#endif
+
+//! Cantidad maxima de teclas que atiende el reconocedor de gestos, como maximo ocho.
+#ifndef GESTURE_MAX_KEYS
+#define GESTURE_MAX_KEYS 6
+#endif
+
+//! Cantidad maxima de acordes de teclas que se pueden reconocer.
+#ifndef GESTURE_MAX_CHORDS
+#define GESTURE_MAX_CHORDS 2
+#endif
+
+//! Tiempo que hay que mantener presionada una tecla para que se reconozca una pulsacion larga, en milisegundos.
+#ifndef GESTURE_LONG_PRESS_MS
+#define GESTURE_LONG_PRESS_MS 1000
+#endif
+
+//! Tiempo desde la pulsacion hasta la primera repeticion automatica, en milisegundos.
+#ifndef GESTURE_REPEAT_DELAY_MS
+#define GESTURE_REPEAT_DELAY_MS 500
+#endif
+
+//! Periodo de las primeras repeticiones automaticas, en milisegundos.
+#ifndef GESTURE_REPEAT_SLOW_MS
+#define GESTURE_REPEAT_SLOW_MS 200
+#endif
+
+//! Periodo de las repeticiones automaticas una vez que se aceleran, en milisegundos.
+#ifndef GESTURE_REPEAT_FAST_MS
+#define GESTURE_REPEAT_FAST_MS 50
+#endif
+
+//! Cantidad de repeticiones lentas antes de pasar a las rapidas.
+#ifndef GESTURE_REPEAT_ACCELERATE
+#define GESTURE_REPEAT_ACCELERATE 10
+#endif
+
+//! Tiempo que una tecla de un acorde espera a las demas antes de informarse como pulsacion, en milisegundos.
+#ifndef GESTURE_CHORD_MS
+#define GESTURE_CHORD_MS 50
+#endif
+
+//! Duracion del sonido que confirma cada tecla, en milisegundos, 0 para que las teclas no suenen.
+#ifndef BUZZER_CLICK_MS
+#define BUZZER_CLICK_MS 10
+#endif
+
+//! Tamaño en bytes de una pagina de la memoria no volatil, en la EEPROM del LPC43xx.
+#ifndef STORAGE_PAGE_SIZE
+#define STORAGE_PAGE_SIZE 128
+#endif
+
+//! Primera pagina de la memoria no volatil reservada para la configuracion.
+#ifndef STORAGE_FIRST_PAGE
+#define STORAGE_FIRST_PAGE 0
+#endif
+
+//! Cantidad de paginas del anillo en que se rotan los registros de la configuracion para repartir el desgaste.
+#ifndef STORAGE_PAGES
+#define STORAGE_PAGES 16
+#endif
+
+//! Tiempo sin cambios en la configuracion luego del que se escribe en la memoria no volatil, en milisegundos.
+#ifndef STORAGE_SETTLE_MS
+#define STORAGE_SETTLE_MS 2000
+#endif
+
+//! Si es distinto de cero la pantalla se multiplexa por DMA, sin intervencion del procesador. Con DMA no se regula el
+//! brillo, BOARD_SCREEN_DIMMING no tiene efecto y los digitos con brillo cero solo se apagan.
+#ifndef BOARD_SCREEN_DMA
+#define BOARD_SCREEN_DMA 0
+#endif
+
+//! Si es distinto de cero el brillo de la pantalla se regula acortando el turno de cada digito, solo con el refresco
+//! por SysTick. El SCT mide el tiempo de encendido y su interrupcion apaga el digito por software: no es PWM por
+//! hardware porque en el poncho las habilitaciones de los digitos (P0_0, P0_1, P1_15 y P1_17) no tienen funcion CTOUT.
+#ifndef BOARD_SCREEN_DIMMING
+#define BOARD_SCREEN_DIMMING 1
+#endif
+
+//! Si es distinto de cero el zumbador recibe una onda cuadrada del timer 1, si es cero es un zumbador activo.
+#ifndef BOARD_BUZZER_TONE
+#define BOARD_BUZZER_TONE 1
+#endif
+
+//! Si es distinto de cero se captura un pulso de referencia por segundo para corregir la frecuencia del SysTick.
+#ifndef BOARD_PPS_INPUT
+#define BOARD_PPS_INPUT 0
+#endif
+
+//! Si es distinto de cero la hora la lleva el RTC con su interrupcion de cada segundo, sino se cuentan los SysTick.
+//! La calibracion del RTC corrige salteando o repitiendo segundos enteros, con la referencia se cuentan los SysTick.
+#ifndef BOARD_RTC_TIMEBASE
+#define BOARD_RTC_TIMEBASE (!BOARD_PPS_INPUT)
+#endif
+
+//! Cantidad de intervalos entre pulsos de referencia que se promedian en cada estimacion del error de frecuencia.
+#ifndef PPS_WINDOW_PULSES
+#define PPS_WINDOW_PULSES 16
+#endif
+
+//! Cantidad de estimaciones sobre las que se suaviza el error de frecuencia, cada una aporta esta fraccion.
+#ifndef PPS_FILTER_WINDOWS
+#define PPS_FILTER_WINDOWS 4
+#endif
+
+//! Desviacion maxima de un intervalo entre pulsos de referencia, en partes por millon, los demas se descartan.
+#ifndef PPS_TOLERANCE_PPM
+#define PPS_TOLERANCE_PPM 500
+#endif
+
+//! Cambio del error de frecuencia, en partes por mil millones, a partir del que se guarda con la configuracion.
+#ifndef PPS_SAVE_PPB
+#define PPS_SAVE_PPB 100
+#endif
+
+//! Frecuencia con la que el DMA cambia de digito cuando multiplexa la pantalla.
+#ifndef SCREEN_DMA_SLOT_RATE_HZ
+#define SCREEN_DMA_SLOT_RATE_HZ 2000
+#endif
+
+//! Transferencias por digito, las cuatro primeras lo preparan y el resto lo mantienen encendido.
+#ifndef SCREEN_DMA_STEPS_PER_DIGIT
+#define SCREEN_DMA_STEPS_PER_DIGIT 8
+#endif
+
+//! Canal del GPDMA reservado para multiplexar la pantalla.
+#ifndef SCREEN_DMA_CHANNEL
+#define SCREEN_DMA_CHANNEL 7
+#endif
+
+//! Si es distinto de cero las teclas se atienden por interrupcion de pines con antirrebote por temporizador.
+#ifndef DIGITAL_INPUT_INTERRUPTS
+#define DIGITAL_INPUT_INTERRUPTS 1
+#endif
+
+//! Duracion del antirrebote de las teclas, en milisegundos.
+#ifndef DIGITAL_DEBOUNCE_MS
+#define DIGITAL_DEBOUNCE_MS 20
+#endif
+
+//! Cantidad maxima de puertos GPIO distintos que puede abarcar un grupo de entradas digitales.
+#ifndef DIGITAL_GROUP_MAX_PORTS
+#define DIGITAL_GROUP_MAX_PORTS 2
+#endif
+
+//! Periodo de muestreo del grupo de teclas cuando no se usan interrupciones, en milisegundos.
+#ifndef DIGITAL_GROUP_SAMPLE_MS
+#define DIGITAL_GROUP_SAMPLE_MS 5
+#endif
+
+//! Cantidad de eventos que puede almacenar una cola de eventos, debe ser potencia de dos entre 2 y 32768.
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 16
+#endif
+
+//! Cantidad de colas de eventos disponibles con memoria estatica.
+#ifndef EVENT_QUEUE_INSTANCES
+#define EVENT_QUEUE_INSTANCES 1
+#endif
+
+//! Cantidad maxima de tareas que se pueden registrar en el planificador.
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS 8
+#endif
+
+//! Cantidad de ranuras de la rueda del planificador, debe ser potencia de dos.
+#ifndef SCHEDULER_WHEEL_SLOTS
+#define SCHEDULER_WHEEL_SLOTS 32
+#endif
+
+//! Si es distinto de cero se miden los tiempos de ejecucion de los sitios declarados en profile.h.
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 0
+#endif
+
+//! Cantidad de barras del histograma de cada sitio de medicion, la ultima acumula las duraciones mayores.
+#ifndef PROFILE_HISTOGRAM_BUCKETS
+#define PROFILE_HISTOGRAM_BUCKETS 16
+#endif
+
+//! Si es distinto de cero el SysTick se estira con la pantalla apagada cuando no hay trabajo en los ticks siguientes.
+#ifndef POWER_TICKLESS_IDLE
+#define POWER_TICKLESS_IDLE 1
+#endif
+
+//! Cantidad maxima de ticks que puede cubrir una interrupcion del SysTick estirado.
+#ifndef POWER_MAX_TICK_STRETCH
+#define POWER_MAX_TICK_STRETCH 64
+#endif
+
+/* === End of conditional blocks =================================================================================== */
+
+#endif /* CONFIG_H_ */
@@ -27,8 +27,13 @@ SPDX-License-Identifier: MIT
 /** @file digital.h
  ** @brief Declaraciones del módulo para la gestión de entradas y salidas digitales.
  **
- ** Esta bibloteca puede usar memoria estática o dinámica. La memoria estática se define en el archivo de configuración
- *@anchor "config.h".
+ ** Esta bibloteca puede usar memoria estática o dinámica. La memoria estática se habilita con USE_STATIC_MEMORY y la
+ ** cantidad de objetos de cada tipo se define en el archivo de configuración @anchor "config.h".
+ **
+ ** Crear una entrada o una salida no toca el hardware: la funcion del pin en la SCU, la direccion y el nivel inicial
+ ** los configura la placa para todos los pines de su tabla al arrancar. Un pin que no esta en esa tabla se tiene que
+ ** conectar al GPIO en la SCU antes de crearlo y, una vez creado, configurar con DigitalOutput_Configure o
+ ** DigitalInput_Configure.
  **/
 
 /* === Headers files inclusions ==================================================================================== */
@@ -56,6 +61,8 @@ typedef enum digital_state_e {
 typedef struct digital_output_s * digital_output_t;
 //! Estructura que representa una entrada digital.
 typedef struct digital_input_s * digital_input_t;
+//! Estructura que representa un grupo de entradas digitales que se leen y filtran juntas.
+typedef struct digital_input_group_s * digital_input_group_t;
 //! Estructura que representa una pantalla de 7 segmentos.
 typedef struct display_s * display_t;
 
@@ -70,9 +77,21 @@ typedef struct display_s * display_t;
  * @param gpio puerto de la salida digital
  * @param bit pin de la salida digital
  * @return digital_output_t
+ * @note No cambia la direccion ni el nivel del pin, que ya tiene que estar configurado como salida. La placa
+ * configura juntos todos los pines de su tabla al arrancar, para otros pines se usa DigitalOutput_Configure.
  */
 digital_output_t DigitalOutput_Create(uint8_t gpio, uint8_t bit);
 
+/**
+ * @brief Configura el pin de una salida digital que no configuro la placa.
+ *
+ * Pone el pin en bajo y despues lo configura como salida, para que no aparezca un pulso. La funcion del pin en la SCU
+ * la tiene que haber seleccionado la placa.
+ *
+ * @param self puntero a la instancia de la salida digital devuelta por la funcion DigitalOutput_Create
+ */
+void DigitalOutput_Configure(digital_output_t self);
+
 /**
  * @brief Funcion para activar la salida digital.
  * @param self puntero a la instancia de la salida digital devuelta por la funcion DigitalOutput_Create
@@ -104,11 +123,23 @@ void DigitalOutput_Toggle(digital_output_t self);
  * @param inverted
  * @note Si inverted es verdadero, la entrada digital se considera activa cuando el pin es bajo.
  * @note Si inverted es falso, la entrada digital se considera activa cuando el pin es alto.
+ * @note No cambia la direccion del pin, que ya tiene que estar configurado como entrada. La placa configura juntos
+ * todos los pines de su tabla al arrancar, para otros pines se usa DigitalInput_Configure.
  * @return digital_input_t Puntero a la instancia de la entrada digital creada.
  */
 
 digital_input_t DigitalInput_Create(uint8_t gpio, uint8_t bit, bool inverted);
 
+/**
+ * @brief Configura el pin de una entrada digital que no configuro la placa.
+ *
+ * Configura el pin como entrada y toma su estado actual como punto de partida para detectar cambios. La funcion del
+ * pin en la SCU la tiene que haber seleccionado la placa.
+ *
+ * @param self puntero a la instancia de la entrada digital devuelta por la funcion DigitalInput_Create
+ */
+void DigitalInput_Configure(digital_input_t self);
+
 /**
  * @brief Funcion para leer el estado de la entrada digital.
  *
@@ -151,6 +182,75 @@ bool Digital_WasActivated(digital_input_t self);
 
 bool Digitalt_WasDeactivated(digital_input_t self);
 
+/**
+ * @brief Crea un grupo de entradas digitales vacio.
+ *
+ * Las entradas de un grupo se leen con una unica lectura por puerto y el antirrebote y la deteccion de flancos de
+ * todas ellas se resuelven con operaciones de bits, con un costo que no depende de la cantidad de entradas.
+ *
+ * @return digital_input_group_t Puntero a la instancia del grupo creado.
+ */
+digital_input_group_t DigitalInputGroup_Create(void);
+
+/**
+ * @brief Agrega una entrada digital a un grupo.
+ *
+ * A partir de esta llamada DigitalInput_GetIsActive y Digital_WasChanged de la entrada devuelven el estado y los
+ * flancos calculados en la ultima llamada a DigitalInputGroup_Update, sin leer el pin.
+ *
+ * @param self puntero a la instancia del grupo devuelta por la funcion DigitalInputGroup_Create
+ * @param input puntero a la instancia de la entrada digital devuelta por la funcion DigitalInput_Create
+ * @return int 0 si la entrada se agrego, -1 si ya pertenece a un grupo o el grupo no admite mas puertos.
+ */
+int DigitalInputGroup_Add(digital_input_group_t self, digital_input_t input);
+
+/**
+ * @brief Lee los puertos del grupo y actualiza el estado y los flancos de todas sus entradas.
+ *
+ * Cada entrada cambia de estado luego de cuatro lecturas seguidas con el mismo valor distinto al estado actual. Se
+ * debe llamar periodicamente, por ejemplo cada 5 ms desde una interrupcion de tiempo.
+ *
+ * @param self puntero a la instancia del grupo devuelta por la funcion DigitalInputGroup_Create
+ * @return bool true si alguna entrada del grupo cambio de estado en esta actualizacion.
+ */
+bool DigitalInputGroup_Update(digital_input_group_t self);
+
+/**
+ * @brief Atiende la entrada digital por interrupcion de pines con antirrebote por temporizador.
+ *
+ * Cada flanco del pin dispara una interrupcion que deshabilita el canal y arranca el antirrebote. Cuando pasan
+ * debounce_ticks llamadas a DigitalInput_DebounceTick se vuelve a habilitar el canal y despues se lee el pin, y si el
+ * estado cambio se guarda el flanco para que lo informen Digital_WasChanged, Digital_WasActivated o
+ * Digitalt_WasDeactivated. Un flanco que llega despues de la lectura arranca otro antirrebote. A partir de esta llamada
+ * DigitalInput_GetIsActive devuelve el estado luego del antirrebote y ya no lee el pin.
+ *
+ * @param self puntero a la instancia de la entrada digital devuelta por la funcion DigitalInput_Create
+ * @param channel canal de interrupcion de pines (PININT) a usar, entre 0 y 7
+ * @param debounce_ticks cantidad de llamadas a DigitalInput_DebounceTick que dura el antirrebote
+ * @return int 0 si la interrupcion se configuro, -1 si el canal no es valido o ya esta en uso.
+ * @note Solo disponible si DIGITAL_INPUT_INTERRUPTS es distinto de cero en config.h.
+ */
+int DigitalInput_EnableInterrupt(digital_input_t self, uint8_t channel, uint16_t debounce_ticks);
+
+/**
+ * @brief Avanza el antirrebote de las entradas atendidas por interrupcion.
+ *
+ * Se debe llamar desde una interrupcion periodica con la misma prioridad que las interrupciones de pines. Si no hay
+ * ningun antirrebote en curso no hace ningun trabajo.
+ *
+ * @return bool true si alguna entrada cambio de estado al terminar su antirrebote.
+ * @note Solo disponible si DIGITAL_INPUT_INTERRUPTS es distinto de cero en config.h.
+ */
+bool DigitalInput_DebounceTick(void);
+
+/**
+ * @brief Indica si hay algun antirrebote en curso en las entradas atendidas por interrupcion.
+ *
+ * @return bool true si alguna entrada espera que termine su antirrebote.
+ * @note Solo disponible si DIGITAL_INPUT_INTERRUPTS es distinto de cero en config.h.
+ */
+bool DigitalInput_DebounceActive(void);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,133 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef EVENTS_H_
+#define EVENTS_H_
+
+/** @file events.h
+ ** @brief Declaraciones del módulo de cola de eventos entre las interrupciones y el lazo principal.
+ **
+ ** La cola es un buffer circular de tamaño potencia de dos con un unico productor y un unico consumidor. El productor
+ ** solo escribe el indice de escritura y el consumidor solo escribe el de lectura, por lo que ninguno de los dos extremos
+ ** espera ni necesita deshabilitar interrupciones. Todas las rutinas de interrupcion que agregan eventos a una misma
+ ** cola deben tener la misma prioridad, de forma que ninguna interrumpa a otra y se comporten como un solo productor.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Tipos de eventos que se intercambian entre las interrupciones y el lazo principal
+typedef enum event_type_e {
+    EVENT_KEY_PRESSED,  //!< Se presiono una tecla, source indica cual
+    EVENT_KEY_RELEASED, //!< Se libero una tecla, source indica cual
+    EVENT_SECOND_TICK,  //!< El reloj completo un segundo, data es distinto de cero si ademas completo un minuto
+    EVENT_REFERENCE,    //!< Los pulsos de referencia completaron una nueva estimacion del error de frecuencia
+} event_type_t;
+
+//! Evento de la aplicacion
+typedef struct event_s {
+    uint8_t type;   //!< Tipo de evento, uno de los valores de event_type_t
+    uint8_t source; //!< Origen del evento, su significado depende del tipo
+    uint16_t data;  //!< Dato adicional del evento, su significado depende del tipo
+} event_t;
+
+//! Estructura que representa una cola de eventos.
+typedef struct event_queue_s * event_queue_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una cola de eventos vacia.
+ *
+ * Las colas se toman de la memoria del modulo, con USE_STATIC_MEMORY hay EVENT_QUEUE_INSTANCES colas disponibles.
+ *
+ * @return event_queue_t Puntero a la cola creada o NULL si no quedan colas disponibles.
+ */
+event_queue_t EventQueue_Create(void);
+
+/**
+ * @brief Agrega un evento a la cola.
+ *
+ * Solo se debe llamar desde el contexto productor de la cola.
+ *
+ * @param self Puntero a la cola de eventos.
+ * @param event Evento a agregar.
+ * @return bool true si el evento se agrego, false si la cola estaba llena y el evento se descarto.
+ */
+bool EventQueue_Push(event_queue_t self, const event_t * event);
+
+/**
+ * @brief Saca el evento mas antiguo de la cola.
+ *
+ * Solo se debe llamar desde el contexto consumidor de la cola.
+ *
+ * @param self Puntero a la cola de eventos.
+ * @param event Estructura donde se copia el evento.
+ * @return bool true si se saco un evento, false si la cola estaba vacia.
+ */
+bool EventQueue_Pop(event_queue_t self, event_t * event);
+
+/**
+ * @brief Indica si la cola no tiene eventos pendientes.
+ *
+ * @param self Puntero a la cola de eventos.
+ * @return bool true si la cola esta vacia.
+ */
+bool EventQueue_IsEmpty(event_queue_t self);
+
+/**
+ * @brief Indica cuantos eventos se descartaron por encontrar la cola llena.
+ *
+ * @param self Puntero a la cola de eventos.
+ * @return uint16_t Cantidad de eventos descartados desde que se creo la cola.
+ */
+uint16_t EventQueue_Overflows(event_queue_t self);
+
+/**
+ * @brief Indica la maxima cantidad de eventos que llego a tener la cola al mismo tiempo.
+ *
+ * @param self Puntero a la cola de eventos.
+ * @return uint16_t Maxima ocupacion de la cola desde que se creo.
+ */
+uint16_t EventQueue_HighWater(event_queue_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENTS_H_ */
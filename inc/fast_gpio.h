@@ -0,0 +1,143 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef FAST_GPIO_H_
+#define FAST_GPIO_H_
+
+/** @file fast_gpio.h
+ ** @brief Acceso directo a los registros de los puertos GPIO del LPC43xx.
+ **
+ ** Cada funcion se resuelve en una unica lectura o escritura de registro. Las operaciones sobre varios bits usan los
+ ** registros SET, CLR y NOT del puerto, que solo modifican los bits indicados, y las escrituras enmascaradas usan el
+ ** registro MPIN, que solo modifica los bits habilitados con FastGpioSetWritable.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Pone en alto los bits indicados de un puerto.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @param mask Mascara de bits a poner en alto.
+ */
+static inline void FastGpioSet(uint8_t gpio, uint32_t mask) {
+    LPC_GPIO_PORT->SET[gpio] = mask;
+}
+
+/**
+ * @brief Pone en bajo los bits indicados de un puerto.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @param mask Mascara de bits a poner en bajo.
+ */
+static inline void FastGpioClear(uint8_t gpio, uint32_t mask) {
+    LPC_GPIO_PORT->CLR[gpio] = mask;
+}
+
+/**
+ * @brief Invierte el estado de los bits indicados de un puerto.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @param mask Mascara de bits a invertir.
+ */
+static inline void FastGpioToggle(uint8_t gpio, uint32_t mask) {
+    LPC_GPIO_PORT->NOT[gpio] = mask;
+}
+
+/**
+ * @brief Escribe el estado de un unico bit usando su registro de byte.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @param bit Numero de bit dentro del puerto.
+ * @param state Estado a escribir en el bit.
+ */
+static inline void FastGpioWriteBit(uint8_t gpio, uint8_t bit, bool state) {
+    LPC_GPIO_PORT->B[gpio][bit] = state;
+}
+
+/**
+ * @brief Lee el estado de un unico bit usando su registro de byte.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @param bit Numero de bit dentro del puerto.
+ * @return bool Estado del bit.
+ */
+static inline bool FastGpioReadBit(uint8_t gpio, uint8_t bit) {
+    return LPC_GPIO_PORT->B[gpio][bit] != 0;
+}
+
+/**
+ * @brief Lee el estado de todos los bits de un puerto.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @return uint32_t Estado de los bits del puerto.
+ */
+static inline uint32_t FastGpioReadPort(uint8_t gpio) {
+    return LPC_GPIO_PORT->PIN[gpio];
+}
+
+/**
+ * @brief Define que bits de un puerto se modifican con FastGpioWriteMasked.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @param mask Mascara de bits que se pueden escribir, el resto del puerto queda protegido.
+ * @note La mascara es unica por puerto, todos los usuarios de FastGpioWriteMasked sobre un puerto deben compartirla.
+ */
+static inline void FastGpioSetWritable(uint8_t gpio, uint32_t mask) {
+    LPC_GPIO_PORT->MASK[gpio] = ~mask;
+}
+
+/**
+ * @brief Escribe de una sola vez todos los bits habilitados de un puerto.
+ *
+ * @param gpio Numero de puerto GPIO.
+ * @param value Valor a escribir, los bits protegidos por la mascara del puerto se ignoran.
+ */
+static inline void FastGpioWriteMasked(uint8_t gpio, uint32_t value) {
+    LPC_GPIO_PORT->MPIN[gpio] = value;
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAST_GPIO_H_ */
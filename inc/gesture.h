@@ -0,0 +1,127 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef GESTURE_H_
+#define GESTURE_H_
+
+/** @file gesture.h
+ ** @brief Declaraciones del módulo de reconocimiento de gestos de las teclas.
+ **
+ ** El modulo recibe los flancos ya filtrados de las teclas, cada uno con la marca de tiempo del tick en que se
+ ** detecto, y los convierte en pulsaciones, liberaciones, pulsaciones largas, repeticiones automaticas que se aceleran
+ ** mientras la tecla sigue presionada y acordes de varias teclas presionadas juntas. Todos los plazos se miden con las
+ ** marcas de tiempo y vencen con una unica tarea del planificador, por lo que el comportamiento no depende de cuanto
+ ** tarda el lazo principal en procesar los eventos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "scheduler.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! La tecla genera GESTURE_LONG_PRESS si se mantiene presionada GESTURE_LONG_PRESS_MS
+#define GESTURE_OPTION_LONG_PRESS (1 << 0)
+
+//! La tecla genera GESTURE_REPEAT mientras se mantiene presionada, primero lento y luego rapido
+#define GESTURE_OPTION_REPEAT     (1 << 1)
+
+/* === Public data type declarations =============================================================================== */
+
+//! Gestos que se informan
+typedef enum gesture_e {
+    GESTURE_PRESS,      //!< Se presiono la tecla
+    GESTURE_RELEASE,    //!< Se libero la tecla
+    GESTURE_LONG_PRESS, //!< La tecla sigue presionada despues de GESTURE_LONG_PRESS_MS
+    GESTURE_REPEAT,     //!< Repeticion automatica de una tecla que sigue presionada
+    GESTURE_CHORD,      //!< Se presionaron juntas todas las teclas de un acorde, se informa el numero de acorde
+} gesture_t;
+
+//! Funcion que recibe los gestos, key es el numero de tecla o el numero de acorde para GESTURE_CHORD
+typedef void (*gesture_handler_t)(gesture_t gesture, uint8_t key, void * context);
+
+//! Estructura que representa el reconocedor de gestos.
+typedef struct gestures_s * gestures_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea el reconocedor de gestos, hay una sola instancia.
+ *
+ * Toma una tarea del planificador para los vencimientos y usa sus marcas de tiempo como reloj.
+ *
+ * @param scheduler Planificador que da la hora y vence los plazos.
+ * @param handler Funcion que recibe los gestos, se llama desde el lazo principal.
+ * @param context Parametro que se le pasa a la funcion.
+ * @return gestures_t Puntero al reconocedor o NULL si no se pudo crear.
+ */
+gestures_t GesturesCreate(scheduler_t scheduler, gesture_handler_t handler, void * context);
+
+/**
+ * @brief Elige los gestos que genera una tecla mientras se mantiene presionada.
+ *
+ * @param self Puntero al reconocedor.
+ * @param key Numero de tecla, menor que GESTURE_MAX_KEYS.
+ * @param options GESTURE_OPTION_LONG_PRESS, GESTURE_OPTION_REPEAT o 0, no se pueden combinar.
+ * @return int 0 si se configuro, -1 si los parametros no son validos.
+ */
+int GesturesConfigure(gestures_t self, uint8_t key, uint8_t options);
+
+/**
+ * @brief Agrega un acorde de teclas.
+ *
+ * Las teclas de un acorde demoran su pulsacion GESTURE_CHORD_MS esperando a las demas. Si se completa el acorde se
+ * informa GESTURE_CHORD y ninguna de sus teclas genera otros gestos hasta que se libera.
+ *
+ * @param self Puntero al reconocedor.
+ * @param keys Mascara con un bit por tecla, al menos dos teclas.
+ * @return int Numero del acorde o -1 si no es valido o no quedan acordes disponibles.
+ */
+int GesturesAddChord(gestures_t self, uint8_t keys);
+
+/**
+ * @brief Informa un flanco de una tecla.
+ *
+ * @param self Puntero al reconocedor.
+ * @param key Numero de tecla.
+ * @param pressed true si se presiono, false si se libero.
+ * @param timestamp Milisegundos de SchedulerGetTime en que se detecto el flanco, truncados a 16 bits.
+ */
+void GesturesKeyEvent(gestures_t self, uint8_t key, bool pressed, uint16_t timestamp);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GESTURE_H_ */
@@ -210,6 +210,13 @@ extern "C" {
 #define PONCHO_RGB_BLUE_GPIO  0
 #define PONCHO_RGB_BLUE_BIT   10
 
+// Entrada libre del conector (GPIO0 de la EDU-CIAA) que recibe los pulsos de referencia, en la captura 0 del timer 2
+#define REFERENCE_PORT        6
+#define REFERENCE_PIN         1
+#define REFERENCE_FUNC        SCU_MODE_FUNC5
+#define REFERENCE_GPIO        3
+#define REFERENCE_BIT         0
+
 /* === Public data type declarations =========================================================== */
 
 /* === Public variable declarations ============================================================ */
@@ -0,0 +1,85 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef POOL_H_
+#define POOL_H_
+
+/** @file pool.h
+ ** @brief Reserva de memoria para los objetos de los modulos.
+ **
+ ** Cada modulo define con POOL_DEFINE la funcion privada que entrega la memoria de sus objetos. Con USE_STATIC_MEMORY
+ ** los objetos se toman en orden de un arreglo estatico de tamaño fijo, sino se piden al heap. En los dos casos la
+ ** memoria se entrega en cero y la aplicacion nunca la libera.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/**
+ * @brief Define una funcion privada sin parametros que reserva la memoria para un objeto.
+ *
+ * La funcion definida devuelve un puntero a la memoria reservada, en cero, o NULL si no hay memoria disponible.
+ *
+ * @param function Nombre de la funcion a definir.
+ * @param type Tipo del objeto, normalmente la estructura privada del modulo.
+ * @param count Cantidad de objetos disponibles con USE_STATIC_MEMORY, como maximo 255.
+ */
+#if USE_STATIC_MEMORY
+#define POOL_DEFINE(function, type, count)                                                                             \
+    static type * function(void) {                                                                                     \
+        static type pool[count];                                                                                       \
+        static uint8_t used;                                                                                           \
+                                                                                                                       \
+        return (used < (count)) ? &pool[used++] : NULL;                                                                \
+    }
+#else
+#define POOL_DEFINE(function, type, count)                                                                             \
+    static type * function(void) {                                                                                     \
+        return calloc(1, sizeof(type));                                                                                \
+    }
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POOL_H_ */
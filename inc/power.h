@@ -0,0 +1,114 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef POWER_H_
+#define POWER_H_
+
+/** @file power.h
+ ** @brief Declaraciones del módulo de administracion de energia del lazo principal.
+ **
+ ** El lazo principal duerme con WFI cuando no tiene trabajo pendiente. La comprobacion del trabajo pendiente y la
+ ** instruccion WFI se ejecutan con las interrupciones deshabilitadas, asi un evento que llega justo antes de dormir
+ ** despierta al procesador en lugar de esperar a la interrupcion siguiente.
+ **
+ ** Cuando no hace falta atender cada tick, por ejemplo con la pantalla apagada, el SysTick se estira mientras el
+ ** procesador duerme para que la proxima interrupcion llegue recien en el primer tick con trabajo. La rutina de
+ ** interrupcion consulta con PowerTickElapsed cuantos ticks cubre cada interrupcion, de modo que el reloj y el
+ ** planificador no pierden tiempo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Funcion que indica, con las interrupciones deshabilitadas, si el lazo principal tiene trabajo pendiente
+typedef bool (*power_pending_t)(void);
+
+//! Funcion que indica, con las interrupciones deshabilitadas, cuantos ticks faltan para el proximo tick con trabajo
+typedef uint32_t (*power_deadline_t)(void);
+
+//! Contadores de tiempo dormido y despierto, en ciclos del procesador
+typedef struct power_stats_s {
+    uint64_t total;   //!< Tiempo transcurrido desde PowerInit
+    uint64_t asleep;  //!< Tiempo dormido dentro de PowerIdle
+    uint32_t wakeups; //!< Cantidad de veces que el procesador desperto
+    uint32_t ticks;   //!< Interrupciones del SysTick atendidas, menos que los ticks si se estiro el SysTick
+} power_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicializa la administracion de energia, despues de configurar el SysTick.
+ *
+ * @param ticks_per_second Frecuencia del tick del sistema.
+ */
+void PowerInit(uint32_t ticks_per_second);
+
+/**
+ * @brief Informa cuantos ticks cubre la interrupcion actual del SysTick.
+ *
+ * Al volver de la interrupcion el SysTick recupera el periodo de un tick, solo se estira dentro de PowerIdle.
+ *
+ * Se debe llamar una vez al comienzo de la rutina de interrupcion del SysTick.
+ *
+ * @return uint16_t Ticks transcurridos desde la interrupcion anterior.
+ */
+uint16_t PowerTickElapsed(void);
+
+/**
+ * @brief Duerme el procesador hasta la proxima interrupcion si no hay trabajo pendiente.
+ *
+ * Los ticks que devuelve deadline se cuentan desde la ultima interrupcion del SysTick. Si son mas que los del periodo
+ * en curso el periodo siguiente se estira para cubrir la diferencia, hasta POWER_MAX_TICK_STRETCH ticks.
+ *
+ * @param pending Funcion que indica si hay trabajo pendiente, se llama con las interrupciones deshabilitadas.
+ * @param deadline Funcion que indica los ticks hasta el proximo tick con trabajo, NULL para no estirar el SysTick.
+ */
+void PowerIdle(power_pending_t pending, power_deadline_t deadline);
+
+/**
+ * @brief Copia los contadores de tiempo dormido y despierto.
+ *
+ * @param stats Estructura donde se copian los contadores.
+ */
+void PowerGetStats(power_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_H_ */
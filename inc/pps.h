@@ -0,0 +1,103 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PPS_H_
+#define PPS_H_
+
+/** @file pps.h
+ ** @brief Declaraciones del módulo que estima el error de frecuencia de la base de tiempo con pulsos de referencia.
+ **
+ ** Una referencia externa, como la salida de un pulso por segundo de un GPS o un generador de laboratorio, marca el
+ ** comienzo de cada segundo en una entrada de captura. La captura guarda la cuenta de un contador que avanza con el
+ ** mismo oscilador que el SysTick, por lo que la diferencia entre dos capturas mide cuanto dura un segundo verdadero
+ ** en cuentas de ese oscilador. Las diferencias se promedian en ventanas de PPS_WINDOW_PULSES pulsos y cada ventana
+ ** se suaviza con las anteriores, asi el ruido de la captura y del pulso no llega a la correccion. Los intervalos que
+ ** se apartan mas de PPS_TOLERANCE_PPM del nominal, por un pulso perdido o una interferencia, descartan la ventana.
+ **
+ ** El modulo no accede al hardware, recibe las capturas y entrega el error, para poder probarlo con trenes de pulsos
+ ** sinteticos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Funciones de la entrada de captura que recibe los pulsos de referencia
+typedef struct pps_capture_driver_s {
+    uint32_t (*Rate)(void); //!< Devuelve la frecuencia del contador de la captura, en hertz
+    uint32_t (*Read)(void); //!< Devuelve la cuenta capturada con el ultimo pulso y borra el pedido de interrupcion
+} const * pps_capture_driver_t;
+
+//! Estructura que representa el estimador del error de frecuencia.
+typedef struct pps_s * pps_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea el estimador del error de frecuencia, hay una sola instancia.
+ *
+ * @param rate Cuentas del contador de la captura en un segundo, segun la frecuencia nominal de su oscilador.
+ * @return pps_t Puntero al estimador o NULL si ya se creo o la frecuencia no es valida.
+ */
+pps_t PpsCreate(uint32_t rate);
+
+/**
+ * @brief Informa la cuenta capturada al llegar un pulso de referencia.
+ *
+ * Esta funcion esta pensada para ser llamada desde la rutina de interrupcion de la captura.
+ *
+ * @param self Puntero al estimador.
+ * @param capture Cuenta del contador en el flanco del pulso, puede dar la vuelta entre dos pulsos.
+ * @return bool true si con este pulso se completo una ventana y el error estimado cambio.
+ */
+bool PpsCapture(pps_t self, uint32_t capture);
+
+/**
+ * @brief Obtiene el error estimado de la frecuencia del oscilador.
+ *
+ * @param self Puntero al estimador.
+ * @param error Donde se copia el error en partes por mil millones, positivo si el oscilador es mas rapido que su
+ * frecuencia nominal. No se modifica si todavia no se completo ninguna ventana.
+ * @return bool true si hay una estimacion, false si todavia no se completo ninguna ventana.
+ */
+bool PpsGetError(pps_t self, int32_t * error);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PPS_H_ */
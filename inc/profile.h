@@ -0,0 +1,139 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+/** @file profile.h
+ ** @brief Declaraciones del módulo de medicion de tiempos de ejecucion con el contador de ciclos.
+ **
+ ** Cada sitio de medicion acumula la cantidad de muestras, los tiempos minimo, maximo y medio y un histograma con una
+ ** barra por potencia de dos. En el procesador los tiempos se miden en ciclos con el contador CYCCNT del DWT, en la
+ ** computadora de desarrollo se miden en nanosegundos con el reloj monotonico del sistema operativo.
+ **
+ ** Con PROFILE_ENABLED en cero las macros de medicion no generan codigo. Cada sitio se debe medir siempre desde el
+ ** mismo contexto de ejecucion, ya que las estadisticas se actualizan sin deshabilitar interrupciones.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include <stdint.h>
+#if defined(__arm__)
+#include "chip.h"
+#endif
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#if PROFILE_ENABLED
+//! Marca el comienzo de una region medida, se debe cerrar con PROFILE_STOP en el mismo bloque
+#define PROFILE_START(site) const uint32_t profile_start_##site = ProfileCycles()
+//! Marca el final de una region medida y acumula su duracion en las estadisticas del sitio
+#define PROFILE_STOP(site)  ProfileRecord((site), ProfileCycles() - profile_start_##site)
+#else
+#define PROFILE_START(site)
+#define PROFILE_STOP(site)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Sitios de medicion de la aplicacion, para medir una region nueva se agrega un valor antes de PROFILE_SITES
+typedef enum profile_site_e {
+    PROFILE_SCREEN_REFRESH,      //!< Refresco de un digito de la pantalla
+    PROFILE_DIGITAL_WAS_CHANGED, //!< Lectura de los flancos de una tecla
+    PROFILE_BOARD_CREATE,        //!< Creacion e inicializacion de la placa
+    PROFILE_SITES,
+} profile_site_t;
+
+//! Estadisticas acumuladas de un sitio de medicion
+typedef struct profile_stats_s {
+    uint32_t count;                               //!< Cantidad de muestras
+    uint32_t min;                                 //!< Duracion minima
+    uint32_t max;                                 //!< Duracion maxima
+    uint64_t total;                               //!< Suma de las duraciones, para calcular la media
+    uint32_t histogram[PROFILE_HISTOGRAM_BUCKETS]; //!< Muestras por barra, la barra n cuenta duraciones menores a 2^n
+} profile_stats_t;
+
+//! Funcion que recibe cada linea de texto del volcado de las estadisticas
+typedef void (*profile_output_t)(const char * line);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Habilita el contador de ciclos y borra las estadisticas de todos los sitios.
+ */
+void ProfileInit(void);
+
+/**
+ * @brief Lee el contador de ciclos.
+ *
+ * En el procesador es una unica lectura de registro, para no agregar demoras a la region medida.
+ *
+ * @return uint32_t Valor actual del contador, en ciclos del procesador o nanosegundos en la computadora.
+ */
+#if defined(__arm__)
+static inline uint32_t ProfileCycles(void) {
+    return DWT->CYCCNT;
+}
+#else
+uint32_t ProfileCycles(void);
+#endif
+
+/**
+ * @brief Agrega una muestra a las estadisticas de un sitio.
+ *
+ * @param site Sitio de medicion.
+ * @param cycles Duracion medida.
+ */
+void ProfileRecord(profile_site_t site, uint32_t cycles);
+
+/**
+ * @brief Copia las estadisticas de un sitio.
+ *
+ * @param site Sitio de medicion.
+ * @param stats Estructura donde se copian las estadisticas.
+ * @return int 0 si se copiaron las estadisticas, -1 si el sitio no existe.
+ */
+int ProfileGet(profile_site_t site, profile_stats_t * stats);
+
+/**
+ * @brief Vuelca como texto las estadisticas de todos los sitios con al menos una muestra.
+ *
+ * @param output Funcion que recibe cada linea del volcado.
+ */
+void ProfileDump(profile_output_t output);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H_ */
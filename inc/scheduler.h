@@ -0,0 +1,167 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/** @file scheduler.h
+ ** @brief Declaraciones del módulo planificador de tareas periodicas y de disparo unico.
+ **
+ ** El planificador usa una rueda de temporizacion: cada tarea activa esta en la ranura de la rueda que corresponde a
+ ** su vencimiento, junto con la cantidad de vueltas completas que le faltan. Agregar o detener una tarea es de orden
+ ** constante y en cada tick solo se recorre la ranura actual. La rutina de interrupcion del tick solo avanza los
+ ** contadores de ticks y de milisegundos, las tareas vencidas se ejecutan desde el lazo principal con SchedulerRun, las
+ ** que vencen en el mismo tick en el orden en que se programaron.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Funcion que se ejecuta cuando vence una tarea
+typedef void (*scheduler_callback_t)(void * context);
+
+//! Estructura que representa un planificador de tareas.
+typedef struct scheduler_s * scheduler_t;
+
+//! Estructura que representa una tarea del planificador.
+typedef struct scheduler_task_s * scheduler_task_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un planificador de tareas.
+ *
+ * Hay un solo planificador con SCHEDULER_MAX_TASKS tareas, que se toman de la memoria del planificador.
+ *
+ * @param ticks_per_second Cantidad de llamadas a SchedulerTick por segundo.
+ * @return scheduler_t Puntero al planificador creado o NULL si ya se habia creado.
+ */
+scheduler_t SchedulerCreate(uint16_t ticks_per_second);
+
+/**
+ * @brief Crea una tarea detenida en el planificador.
+ *
+ * @param self Puntero al planificador.
+ * @param callback Funcion a ejecutar cada vez que vence la tarea.
+ * @param context Parametro que se le pasa a la funcion.
+ * @return scheduler_task_t Puntero a la tarea creada o NULL si no quedan tareas disponibles.
+ */
+scheduler_task_t SchedulerAddTask(scheduler_t self, scheduler_callback_t callback, void * context);
+
+/**
+ * @brief Inicia o reinicia una tarea.
+ *
+ * Los tiempos se redondean hacia arriba al siguiente tick, con un minimo de un tick.
+ *
+ * @param self Puntero al planificador.
+ * @param task Puntero a la tarea.
+ * @param delay Tiempo hasta la primera ejecucion, en milisegundos.
+ * @param period Tiempo entre ejecuciones sucesivas en milisegundos, 0 para una tarea de disparo unico.
+ * @return int 0 si la tarea se inicio, -1 si los parametros no son validos.
+ */
+int SchedulerStart(scheduler_t self, scheduler_task_t task, uint32_t delay, uint32_t period);
+
+/**
+ * @brief Detiene una tarea, si estaba vencida y pendiente de ejecucion ya no se ejecuta.
+ *
+ * @param self Puntero al planificador.
+ * @param task Puntero a la tarea.
+ * @return int 0 si la tarea se detuvo, -1 si los parametros no son validos.
+ */
+int SchedulerStop(scheduler_t self, scheduler_task_t task);
+
+/**
+ * @brief Indica si una tarea esta esperando su vencimiento.
+ *
+ * @param task Puntero a la tarea.
+ * @return bool true si la tarea esta activa, false si esta detenida.
+ */
+bool SchedulerIsActive(scheduler_task_t task);
+
+/**
+ * @brief Indica si hay ticks registrados que todavia no proceso SchedulerRun.
+ *
+ * @param self Puntero al planificador.
+ * @return bool true si hay que llamar a SchedulerRun.
+ */
+bool SchedulerPending(scheduler_t self);
+
+/**
+ * @brief Calcula cuantos ticks faltan para el vencimiento de la proxima tarea.
+ *
+ * Recorre una vez la rueda, se llama desde el lazo principal antes de dormir y no desde la interrupcion.
+ *
+ * @param self Puntero al planificador.
+ * @return uint32_t Ticks desde el ultimo tick procesado hasta el proximo vencimiento, UINT32_MAX si no hay tareas
+ * activas.
+ */
+uint32_t SchedulerTicksToNext(scheduler_t self);
+
+/**
+ * @brief Indica el tiempo transcurrido segun los ticks registrados, para usar como marca de tiempo.
+ *
+ * Se puede llamar desde el lazo principal o desde una interrupcion con la misma prioridad que la del tick.
+ *
+ * @param self Puntero al planificador.
+ * @return uint32_t Milisegundos desde que se creo el planificador.
+ */
+uint32_t SchedulerGetTime(scheduler_t self);
+
+/**
+ * @brief Registra el paso de un tick del planificador.
+ *
+ * Se llama desde la rutina de interrupcion del temporizador del sistema.
+ *
+ * @param self Puntero al planificador.
+ */
+void SchedulerTick(scheduler_t self);
+
+/**
+ * @brief Avanza la rueda hasta el ultimo tick registrado y ejecuta las tareas vencidas.
+ *
+ * Se llama desde el lazo principal, las tareas se ejecutan en ese contexto y pueden iniciar o detener cualquier tarea.
+ *
+ * @param self Puntero al planificador.
+ */
+void SchedulerRun(scheduler_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_ */
@@ -27,6 +27,14 @@ SPDX-License-Identifier: MIT
 /** @file screen.h
  ** @brief Declaraciones del módulo para la gestión de euna pantalla de 7 segmentos 4 digitos multiplexada.
  **
+ ** Las funciones que modifican el contenido de la pantalla componen un cuadro nuevo y lo publican de una sola vez, por
+ ** lo que ScreenRefresh se puede llamar desde una interrupcion. Todas las funciones que modifican el contenido deben
+ ** llamarse desde un mismo contexto de ejecucion.
+ **
+ ** Varias pantallas que comparten los segmentos, por ejemplo una de hora y otra de fecha, se refrescan juntas con el
+ ** servicio de refresco: ScreenServiceRefresh enciende un unico digito por llamada e intercala los digitos de todas
+ ** las pantallas registradas, de modo que cada digito ocupa la misma fraccion del tiempo sin importar a que pantalla
+ ** pertenece.
  **/
 
 /* === Headers files inclusions ==================================================================================== */
@@ -51,6 +59,9 @@ extern "C" {
 #define SEGMENT_G (1 << 6)
 #define SEGMENT_P (1 << 7)
 
+//! Brillo maximo de la pantalla o de un digito, los digitos quedan encendidos durante todo su turno
+#define SCREEN_BRIGHTNESS_MAX 255
+
 /* === Public data type declarations =============================================================================== */
 /** Estructura que representa una pantalla de 7 segmentos multiplexada. */
 typedef struct screen_s *screen_t;
@@ -58,12 +69,22 @@ typedef struct screen_s *screen_t;
 typedef void (*digits_turn_off_t)(void);
 typedef void (*segments_update_t)(uint8_t value);
 typedef void (*digits_turn_on_t)(uint8_t digit);
+typedef void (*frame_update_t)(const uint8_t images[], uint8_t digits);
+typedef void (*digit_brightness_t)(uint8_t digit, uint8_t level);
 // Estructura que representa el driver de la pantalla de 7 segmentos multiplexada.
 // Contiene punteros a las funciones que manejan los digitos y segmentos de la pantalla.
+// Si el hardware multiplexa la pantalla por su cuenta (por ejemplo con DMA) el driver define FrameUpdate, que recibe
+// el cuadro completo solo cuando cambia, y las funciones de digitos y segmentos no se usan. Ese cuadro no lleva el
+// brillo: los digitos con brillo cero llegan apagados y el resto se muestra con el brillo maximo.
+// Si el hardware puede apagar el digito antes de terminar su turno el driver define DigitBrightness, que se llama
+// despues de encender cada digito con el brillo que le corresponde. Sin esta funcion los digitos solo se encienden con
+// el brillo maximo o se dejan apagados con brillo cero.
 typedef struct screen_driver_s{
     digits_turn_off_t DigitsTurnOff;
     segments_update_t SegmentsUpdate;
     digits_turn_on_t DigitsTurnOn;
+    frame_update_t FrameUpdate;
+    digit_brightness_t DigitBrightness;
 } const * screen_driver_t;
 
 /* === Public variable declarations ================================================================================ */
@@ -87,18 +108,95 @@ screen_t ScreenCreate(uint8_t digits, screen_driver_t driver);
  * @param value Vector de valores BCD a mostrar en la pantalla, cada valor debe estar entre 0 y 9.
  * @param size Tamaño del vector de valores BCD a mostrar en la pantalla.
  * @note Si el tamaño es mayor que el numero de digitos de la pantalla, se limita al numero de digitos.
+ * @note Los puntos decimales encendidos con ScreenSetPoint se conservan.
  */
 void ScreenWriteBCD(screen_t screen, uint8_t value[], uint8_t size);
 
+/**
+ * @brief Indica los segmentos con los que se muestra un caracter.
+ *
+ * La fuente cubre los digitos hexadecimales, las letras que se pueden leer en 7 segmentos y algunos simbolos. Las
+ * letras que no tienen una forma legible, como K, M, V, W y X, y los caracteres fuera de la tabla se muestran apagados.
+ *
+ * @param symbol Caracter ASCII.
+ * @return uint8_t Segmentos del caracter, el punto y la coma encienden solo el punto decimal.
+ */
+uint8_t ScreenGlyph(char symbol);
+
+/**
+ * @brief Escribe un texto en la pantalla, desde el digito de la izquierda.
+ *
+ * Un punto o una coma despues de un caracter enciende el punto decimal de ese digito. Si el texto es mas largo que la
+ * pantalla se muestran solo los primeros digitos, para textos largos se usa ScreenScrollString.
+ *
+ * @param screen Puntero al objeto pantalla.
+ * @param text Texto terminado en cero.
+ * @return int 0 si el texto se escribio, -1 si la pantalla o el texto no son validos.
+ */
+int ScreenWriteString(screen_t screen, const char * text);
+
+/**
+ * @brief Prepara un texto para desplazarlo por la pantalla de derecha a izquierda.
+ *
+ * El texto se convierte a segmentos una sola vez y la pantalla queda apagada. Cada llamada a ScreenScrollStep corre
+ * el contenido un digito a la izquierda y agrega el caracter siguiente por la derecha. El desplazamiento termina al
+ * escribir la pantalla con ScreenWriteBCD, ScreenWriteString u otro texto.
+ *
+ * @param screen Puntero al objeto pantalla.
+ * @param text Texto terminado en cero, de hasta SCREEN_MARQUEE_SIZE digitos.
+ * @return int 0 si el texto se preparo, -1 si la pantalla o el texto no son validos o el texto es muy largo.
+ */
+int ScreenScrollString(screen_t screen, const char * text);
+
+/**
+ * @brief Desplaza el texto preparado con ScreenScrollString un digito a la izquierda.
+ *
+ * Se debe llamar periodicamente desde el mismo contexto que las demas funciones que modifican la pantalla, por ejemplo
+ * desde una tarea del planificador. Despues del texto pasan tantos digitos apagados como tiene la pantalla y el texto
+ * vuelve a empezar.
+ *
+ * @param screen Puntero al objeto pantalla.
+ * @return bool true si el texto termino de salir de la pantalla y vuelve a empezar.
+ */
+bool ScreenScrollStep(screen_t screen);
+
 /**
  * @brief Actualiza la pantalla mostrando el digito actual.
  *
- * Esta funcion se debe llamar periodicamente para actualizar la pantalla.
+ * Esta funcion se debe llamar periodicamente para actualizar la pantalla. Si el driver multiplexa la pantalla por
+ * hardware solo se lleva la cuenta del parpadeo y se entrega un cuadro nuevo al driver cuando el contenido cambia.
  *
  * @param screen Puntero al objeto pantalla.
  */
 void ScreenRefresh(screen_t screen);
 
+/**
+ * @brief Registra una pantalla en el servicio de refresco.
+ *
+ * Las pantallas se deben registrar antes de habilitar la interrupcion que llama a ScreenServiceRefresh. Cada digito de
+ * una pantalla que se multiplexa por software ocupa un turno del barrido, por lo que la frecuencia de refresco de
+ * cada digito es la frecuencia de llamada dividida por la cantidad total de digitos.
+ *
+ * @param screen Puntero al objeto pantalla.
+ * @return int 0 si la pantalla se registro, -1 si no es valida o no hay lugar para mas pantallas.
+ */
+int ScreenServiceAdd(screen_t screen);
+
+/**
+ * @brief Apaga el digito encendido en el turno anterior y enciende el digito del turno siguiente.
+ *
+ * Reemplaza a las llamadas a ScreenRefresh de cada pantalla y se debe llamar periodicamente desde una interrupcion.
+ * Las pantallas que se multiplexan por hardware no ocupan turnos y se atienden en cada llamada.
+ */
+void ScreenServiceRefresh(void);
+
+/**
+ * @brief Indica si todas las pantallas registradas en el servicio de refresco estan apagadas.
+ *
+ * @return bool true si todas las pantallas tienen brillo cero, o si no hay pantallas registradas.
+ */
+bool ScreenServiceBlank(void);
+
 /**
  * @brief Funcion para hacer parpadear los digitos de la pantalla.
  *
@@ -130,6 +228,35 @@ int DisplayFlashPoints(screen_t display, uint8_t from, uint8_t to, uint16_t divi
  */
 void ScreenSetPoint(screen_t screen, uint8_t digit, bool state);
 
+/**
+ * @brief Fija el brillo de toda la pantalla.
+ *
+ * @param screen Puntero al objeto pantalla.
+ * @param level Brillo entre 0 (apagada) y SCREEN_BRIGHTNESS_MAX.
+ * @return int 0 si el brillo se fijo, -1 si la pantalla no es valida.
+ */
+int ScreenSetBrightness(screen_t screen, uint8_t level);
+
+/**
+ * @brief Indica el brillo de toda la pantalla.
+ *
+ * @param screen Puntero al objeto pantalla.
+ * @return uint8_t Brillo fijado con ScreenSetBrightness, 0 si la pantalla esta apagada.
+ */
+uint8_t ScreenGetBrightness(screen_t screen);
+
+/**
+ * @brief Fija el brillo relativo de un digito, que se combina con el brillo de toda la pantalla.
+ *
+ * Permite compensar los digitos con pocos segmentos encendidos, que se ven mas brillantes que los que tienen muchos.
+ *
+ * @param screen Puntero al objeto pantalla.
+ * @param digit Posicion del digito, desde 0 para el de la izquierda.
+ * @param level Brillo relativo entre 0 (apagado) y SCREEN_BRIGHTNESS_MAX.
+ * @return int 0 si el brillo se fijo, -1 si la pantalla o el digito no son validos.
+ */
+int ScreenSetDigitBrightness(screen_t screen, uint8_t digit, uint8_t level);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,117 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef STORAGE_H_
+#define STORAGE_H_
+
+/** @file storage.h
+ ** @brief Declaraciones del módulo de almacenamiento persistente de la configuracion.
+ **
+ ** La configuracion se guarda como un registro con encabezado, version, numero de secuencia y CRC en una pagina de la
+ ** memoria no volatil. Cada registro nuevo se escribe en la pagina siguiente a la del ultimo, recorriendo un anillo de
+ ** STORAGE_PAGES paginas para repartir el desgaste, y al arrancar se toma el registro valido con la secuencia mas alta.
+ ** Un corte de alimentacion durante una escritura deja una pagina con el CRC incorrecto, que se descarta, y se conserva
+ ** el registro anterior. Los cambios se acumulan en memoria y se escriben recien cuando pasan STORAGE_SETTLE_MS sin
+ ** modificaciones, por lo que una secuencia de ajustes con las teclas produce una sola escritura.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "scheduler.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+typedef int (*storage_read_t)(uint16_t page, void * data, uint16_t size);
+typedef int (*storage_write_t)(uint16_t page, const void * data, uint16_t size);
+// Estructura que representa el driver de la memoria no volatil.
+// Read lee y Write borra y programa los primeros size bytes de una pagina de STORAGE_PAGE_SIZE bytes, ambas devuelven
+// 0 si la operacion se completo y -1 si fallo. Los datos estan alineados a palabras de 32 bits.
+typedef struct storage_driver_s {
+    storage_read_t Read;
+    storage_write_t Write;
+} const * storage_driver_t;
+
+//! Estructura que representa el almacenamiento de la configuracion.
+typedef struct storage_s * storage_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea el almacenamiento y busca el registro mas reciente, hay una sola instancia.
+ *
+ * Los registros de otra version o de otro tamaño se ignoran, al cambiar el formato de los datos se cambia la version.
+ *
+ * @param driver Puntero al driver de la memoria.
+ * @param scheduler Planificador del que se toma la tarea que escribe los cambios.
+ * @param version Version del formato de los datos.
+ * @param size Tamaño de los datos en bytes.
+ * @return storage_t Puntero al almacenamiento o NULL si los datos no entran en una pagina o no se pudo crear.
+ */
+storage_t StorageCreate(storage_driver_t driver, scheduler_t scheduler, uint8_t version, uint8_t size);
+
+/**
+ * @brief Recupera los datos del registro mas reciente.
+ *
+ * @param self Puntero al almacenamiento.
+ * @param data Donde se copian los datos, no se modifica si no hay un registro valido.
+ * @return int 0 si se recuperaron los datos, -1 si no hay ningun registro valido.
+ */
+int StorageLoad(storage_t self, void * data);
+
+/**
+ * @brief Registra los datos actuales, se escriben cuando pasan STORAGE_SETTLE_MS sin otros cambios.
+ *
+ * Si los datos son iguales a los ultimos registrados no se programa ninguna escritura.
+ *
+ * @param self Puntero al almacenamiento.
+ * @param data Datos a guardar.
+ * @return int 0 si los datos ya estaban guardados o se programo la escritura, -1 si los parametros no son validos.
+ */
+int StorageSave(storage_t self, const void * data);
+
+/**
+ * @brief Escribe en el momento los cambios pendientes, por ejemplo antes de apagar.
+ *
+ * @param self Puntero al almacenamiento.
+ * @return int 0 si no habia cambios o se escribieron, -1 si fallo la escritura.
+ */
+int StorageFlush(storage_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STORAGE_H_ */
@@ -0,0 +1,127 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef UI_H_
+#define UI_H_
+
+/** @file ui.h
+ ** @brief Declaraciones del módulo de interfaz de usuario del reloj despertador.
+ **
+ ** La interfaz es una maquina de estados definida por una tabla que asocia a cada estado y evento una accion y el
+ ** estado siguiente. Solo trabaja cuando recibe un evento, por lo que no tiene costo mientras no se presiona ninguna
+ ** tecla, y como no lee las teclas ni los temporizadores se puede probar en la computadora de desarrollo enviandole
+ ** todas las combinaciones de estados y eventos.
+ **
+ ** La pantalla muestra horas y minutos. Al configurar la hora o la alarma parpadean primero los minutos y luego las
+ ** horas, y mientras se configura la alarma se encienden todos los puntos decimales. Despues de las horas de la hora
+ ** actual se configura el dia de la semana, que se muestra como "dIA" seguido de un digito, 1 para el domingo y 7 para
+ ** el sabado. El punto del ultimo digito indica
+ ** que la alarma esta habilitada. Cuando la alarma empieza a sonar se desplaza una vez por la pantalla el mensaje "AL"
+ ** con la hora de la alarma, y despues parpadea la hora actual hasta que se atiende la alarma.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "alarm.h"
+#include "clock.h"
+#include "scheduler.h"
+#include "screen.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Estados de la interfaz
+typedef enum ui_state_e {
+    UI_STATE_NONE,        //!< En la tabla de transiciones indica que el estado no cambia
+    UI_SHOW_TIME,         //!< Muestra la hora actual
+    UI_SET_TIME_MINUTES,  //!< Configura los minutos de la hora actual
+    UI_SET_TIME_HOURS,    //!< Configura las horas de la hora actual
+    UI_SET_TIME_WEEKDAY,  //!< Configura el dia de la semana
+    UI_SET_ALARM_MINUTES, //!< Configura los minutos de la alarma
+    UI_SET_ALARM_HOURS,   //!< Configura las horas de la alarma
+    UI_RINGING,           //!< La alarma esta sonando
+    UI_STATES_COUNT,
+} ui_state_t;
+
+//! Eventos que recibe la interfaz
+typedef enum ui_event_e {
+    UI_EVENT_SET_TIME,  //!< Se presiono la tecla de configurar la hora
+    UI_EVENT_SET_ALARM, //!< Se presiono la tecla de configurar la alarma
+    UI_EVENT_INCREMENT, //!< Se presiono la tecla de incrementar
+    UI_EVENT_DECREMENT, //!< Se presiono la tecla de decrementar
+    UI_EVENT_ACCEPT,    //!< Se presiono la tecla de aceptar
+    UI_EVENT_CANCEL,    //!< Se presiono la tecla de cancelar
+    UI_EVENT_SECOND,    //!< Transcurrio un segundo del reloj
+    UI_EVENT_ALARM,     //!< Empezo a sonar una alarma
+    UI_EVENT_TIMEOUT,   //!< Se agoto UI_TIMEOUT_SECONDS o UI_RING_TIMEOUT_SECONDS, lo genera la interfaz
+    UI_EVENTS_COUNT,
+} ui_event_t;
+
+//! Estructura que representa la interfaz de usuario.
+typedef struct ui_s * ui_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea la interfaz de usuario y muestra la hora actual.
+ *
+ * @param clock Reloj que se muestra y se configura.
+ * @param alarms Alarmas del reloj, la interfaz configura la alarma 0.
+ * @param screen Pantalla donde se muestra la hora.
+ * @param scheduler Planificador que marca el paso de los mensajes que se desplazan por la pantalla.
+ * @return ui_t Puntero a la unica instancia de la interfaz o NULL si ya se habia creado.
+ */
+ui_t UiCreate(clock_bcd_t clock, alarms_t alarms, screen_t screen, scheduler_t scheduler);
+
+/**
+ * @brief Procesa un evento, ejecutando la accion y la transicion que indica la tabla para el estado actual.
+ *
+ * @param self Puntero a la interfaz.
+ * @param event Evento a procesar.
+ */
+void UiHandleEvent(ui_t self, ui_event_t event);
+
+/**
+ * @brief Indica el estado actual de la interfaz.
+ *
+ * @param self Puntero a la interfaz.
+ * @return ui_state_t Estado actual.
+ */
+ui_state_t UiGetState(ui_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_H_ */
@@ -0,0 +1,369 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench.c
+ ** @brief Mediciones de rendimiento de los modulos de pantalla y entradas digitales en la computadora de desarrollo.
+ **
+ ** Cada prueba ejecuta la funcion medida muchas veces contra un driver de pantalla vacio y puertos GPIO en memoria
+ ** comun, e informa el tiempo medio por llamada en nanosegundos. ScreenRefresh_board usa el driver de pantalla de la
+ ** placa, de forma que tambien mide los accesos a los puertos. Los resultados se escriben en un archivo JSON con una
+ ** entrada por linea y se comparan con una medicion de referencia guardada en el mismo formato.
+ **
+ ** El programa termina con codigo 1 si alguna prueba es mas lenta que la referencia en mas del margen indicado.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bsp.h"
+#include "chip.h"
+#include "digital.h"
+#include "poncho.h"
+#include "screen.h"
+#include "sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de llamadas por prueba si no se indica otra en la linea de comandos
+#define BENCH_ITERATIONS     2000000
+
+//! Divisor de las llamadas de las pruebas que reservan memoria, para no agotar la memoria de la computadora
+#define BENCH_CREATE_DIVISOR 1000
+
+//! Margen de tolerancia respecto de la referencia si no se indica otro, en porcentaje
+#define BENCH_TOLERANCE      25
+
+//! Cantidad maxima de pruebas
+#define BENCH_MAX_RESULTS    16
+
+//! Longitud maxima del nombre de una prueba
+#define BENCH_NAME_SIZE      32
+
+/* === Private data type declarations ============================================================================== */
+
+//! Resultado de una prueba
+struct bench_result_s {
+    char name[BENCH_NAME_SIZE]; // nombre de la prueba
+    double ns_per_op;           // tiempo medio por llamada en nanosegundos
+};
+
+//! Funcion que ejecuta una vez la operacion medida
+typedef void (*bench_operation_t)(uint32_t iteration);
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lee el reloj monotonico del sistema operativo.
+ *
+ * @return double Tiempo actual en nanosegundos.
+ */
+static double BenchNow(void);
+
+/**
+ * @brief Ejecuta una prueba y guarda su resultado.
+ *
+ * @param name Nombre de la prueba.
+ * @param operation Operacion medida.
+ * @param iterations Cantidad de llamadas.
+ */
+static void BenchRun(const char * name, bench_operation_t operation, uint32_t iterations);
+
+/**
+ * @brief Escribe los resultados en un archivo JSON, con una prueba por linea.
+ *
+ * @param path Nombre del archivo.
+ * @return int 0 si el archivo se escribio, -1 si hubo un error.
+ */
+static int BenchWrite(const char * path);
+
+/**
+ * @brief Lee resultados de un archivo JSON escrito por BenchWrite.
+ *
+ * @param path Nombre del archivo.
+ * @param results Arreglo donde se guardan los resultados leidos.
+ * @return int Cantidad de resultados leidos, -1 si no se pudo abrir el archivo.
+ */
+static int BenchRead(const char * path, struct bench_result_s results[]);
+
+/**
+ * @brief Compara los resultados con una referencia.
+ *
+ * @param path Nombre del archivo de referencia.
+ * @param tolerance Margen de tolerancia en porcentaje.
+ * @return int Cantidad de pruebas mas lentas que la referencia, -1 si no se pudo leer la referencia.
+ */
+static int BenchCompare(const char * path, double tolerance);
+
+static void StubDigitsTurnOff(void);
+static void StubSegmentsUpdate(uint8_t value);
+static void StubDigitsTurnOn(uint8_t digit);
+
+static void OperationScreenWriteBCD(uint32_t iteration);
+static void OperationScreenRefresh(uint32_t iteration);
+static void OperationBoardScreenRefresh(uint32_t iteration);
+static void OperationScreenSetPoint(uint32_t iteration);
+static void OperationWasChanged(uint32_t iteration);
+static void OperationGroupWasChanged(uint32_t iteration);
+static void OperationBoardCreate(uint32_t iteration);
+
+/**
+ * @brief Rutina de interrupcion del SysTick, no se usa en las mediciones.
+ */
+void SysTick_Handler(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Driver de pantalla que no accede a ningun periferico
+static const struct screen_driver_s stub_driver = {
+    .DigitsTurnOff = StubDigitsTurnOff,
+    .SegmentsUpdate = StubSegmentsUpdate,
+    .DigitsTurnOn = StubDigitsTurnOn,
+};
+
+//! Resultados de las pruebas ejecutadas
+static struct bench_result_s results[BENCH_MAX_RESULTS];
+
+//! Cantidad de pruebas ejecutadas
+static uint8_t results_count;
+
+//! Pantalla sobre la que se ejecutan las pruebas
+static screen_t screen;
+
+//! Placa cuya pantalla se refresca con el driver real, que escribe en los puertos en memoria comun
+static Board_t board;
+
+//! Entrada digital leida directamente del puerto
+static digital_input_t input;
+
+//! Entrada digital que pertenece a un grupo
+static digital_input_t grouped;
+
+//! Grupo de la entrada agrupada
+static digital_input_group_t group;
+
+//! Valor que consumen las operaciones para que el compilador no las elimine
+static volatile uint32_t sink;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static double BenchNow(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static void BenchRun(const char * name, bench_operation_t operation, uint32_t iterations) {
+    struct bench_result_s * result = &results[results_count++];
+    double start;
+
+    // Una pasada previa corta para que los datos y el codigo ya esten en la memoria cache
+    for (uint32_t iteration = 0; iteration < iterations / 100; iteration++) {
+        operation(iteration);
+    }
+    start = BenchNow();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        operation(iteration);
+    }
+    result->ns_per_op = (BenchNow() - start) / iterations;
+    snprintf(result->name, sizeof(result->name), "%s", name);
+    printf("%-24s %10.2f ns/op  (%u llamadas)\n", result->name, result->ns_per_op, iterations);
+}
+
+static int BenchWrite(const char * path) {
+    FILE * file = fopen(path, "w");
+
+    if (file == NULL) {
+        fprintf(stderr, "bench: no se puede escribir %s\n", path);
+        return -1;
+    }
+    fprintf(file, "{\n");
+    for (uint8_t index = 0; index < results_count; index++) {
+        fprintf(file, "    \"%s\": %.3f%s\n", results[index].name, results[index].ns_per_op,
+                (index + 1 < results_count) ? "," : "");
+    }
+    fprintf(file, "}\n");
+    fclose(file);
+    return 0;
+}
+
+static int BenchRead(const char * path, struct bench_result_s read[]) {
+    FILE * file = fopen(path, "r");
+    char line[128];
+    int count = 0;
+
+    if (file == NULL) {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file) && (count < BENCH_MAX_RESULTS)) {
+        if (sscanf(line, " \"%31[^\"]\": %lf", read[count].name, &read[count].ns_per_op) == 2) {
+            count++;
+        }
+    }
+    fclose(file);
+    return count;
+}
+
+static int BenchCompare(const char * path, double tolerance) {
+    struct bench_result_s baseline[BENCH_MAX_RESULTS];
+    int count = BenchRead(path, baseline);
+    int slower = 0;
+
+    if (count < 0) {
+        fprintf(stderr, "bench: no se puede leer la referencia %s\n", path);
+        return -1;
+    }
+    printf("\n%-24s %10s %10s %8s\n", "prueba", "referencia", "actual", "cambio");
+    for (uint8_t index = 0; index < results_count; index++) {
+        for (int reference = 0; reference < count; reference++) {
+            if (strcmp(results[index].name, baseline[reference].name) == 0) {
+                double change = 100.0 * (results[index].ns_per_op / baseline[reference].ns_per_op - 1.0);
+                bool regression = change > tolerance;
+
+                printf("%-24s %10.2f %10.2f %+7.1f%%%s\n", results[index].name, baseline[reference].ns_per_op,
+                       results[index].ns_per_op, change, regression ? "  REGRESION" : "");
+                slower += regression;
+            }
+        }
+    }
+    return slower;
+}
+
+static void StubDigitsTurnOff(void) {
+}
+
+static void StubSegmentsUpdate(uint8_t value) {
+    sink = value;
+}
+
+static void StubDigitsTurnOn(uint8_t digit) {
+    sink = digit;
+}
+
+static void OperationScreenWriteBCD(uint32_t iteration) {
+    uint8_t value[4] = {iteration & 7, 2, 5, 9};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+}
+
+static void OperationScreenRefresh(uint32_t iteration) {
+    (void)iteration;
+    ScreenRefresh(screen);
+}
+
+static void OperationBoardScreenRefresh(uint32_t iteration) {
+    (void)iteration;
+    ScreenRefresh(board->screen);
+}
+
+static void OperationScreenSetPoint(uint32_t iteration) {
+    ScreenSetPoint(screen, 1 + (iteration & 3), iteration & 4);
+}
+
+static void OperationWasChanged(uint32_t iteration) {
+    // Cada 64 llamadas cambia el nivel del pin, para medir tambien la deteccion de flancos
+    LPC_GPIO_PORT->B[KEY_F1_GPIO][KEY_F1_BIT] = (iteration >> 6) & 1;
+    sink = Digital_WasChanged(input);
+}
+
+static void OperationGroupWasChanged(uint32_t iteration) {
+    if ((iteration & 63) == 0) {
+        DigitalInputGroup_Update(group);
+    }
+    sink = Digital_WasChanged(grouped);
+}
+
+static void OperationBoardCreate(uint32_t iteration) {
+    (void)iteration;
+    sink = (uintptr_t)Board_Create();
+}
+
+/* === Public function implementation ============================================================================== */
+
+void SysTick_Handler(void) {
+}
+
+void SimTickHook(void) {
+}
+
+void SimPowerLoss(void) {
+}
+
+int main(int argc, char * argv[]) {
+    uint32_t iterations = BENCH_ITERATIONS;
+    double tolerance = BENCH_TOLERANCE;
+    const char * output = NULL;
+    const char * baseline = NULL;
+    int slower = 0;
+
+    for (int option = 1; option < argc; option++) {
+        if ((strcmp(argv[option], "-n") == 0) && (option + 1 < argc)) {
+            iterations = strtoul(argv[++option], NULL, 0);
+        } else if ((strcmp(argv[option], "-o") == 0) && (option + 1 < argc)) {
+            output = argv[++option];
+        } else if ((strcmp(argv[option], "-b") == 0) && (option + 1 < argc)) {
+            baseline = argv[++option];
+        } else if ((strcmp(argv[option], "-t") == 0) && (option + 1 < argc)) {
+            tolerance = strtod(argv[++option], NULL);
+        } else {
+            fprintf(stderr, "uso: %s [-n llamadas] [-o resultados.json] [-b referencia.json] [-t porcentaje]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (iterations < BENCH_CREATE_DIVISOR) {
+        iterations = BENCH_CREATE_DIVISOR;
+    }
+
+    screen = ScreenCreate(4, &stub_driver);
+    input = DigitalInput_Create(KEY_F1_GPIO, KEY_F1_BIT, false);
+    grouped = DigitalInput_Create(KEY_F2_GPIO, KEY_F2_BIT, false);
+    group = DigitalInputGroup_Create();
+    DigitalInputGroup_Add(group, grouped);
+    board = Board_Create();
+
+    BenchRun("ScreenWriteBCD", OperationScreenWriteBCD, iterations);
+    BenchRun("ScreenRefresh", OperationScreenRefresh, iterations);
+    DisplayFlashDigits(screen, 0, 3, 50);
+    BenchRun("ScreenRefresh_flashing", OperationScreenRefresh, iterations);
+    DisplayFlashDigits(screen, 0, 3, 0);
+    BenchRun("ScreenRefresh_board", OperationBoardScreenRefresh, iterations);
+    BenchRun("ScreenSetPoint", OperationScreenSetPoint, iterations);
+    BenchRun("Digital_WasChanged", OperationWasChanged, iterations);
+    BenchRun("Digital_WasChanged_group", OperationGroupWasChanged, iterations);
+    BenchRun("Board_Create", OperationBoardCreate, iterations / BENCH_CREATE_DIVISOR);
+
+    if ((output != NULL) && (BenchWrite(output) != 0)) {
+        return EXIT_FAILURE;
+    }
+    if (baseline != NULL) {
+        slower = BenchCompare(baseline, tolerance);
+    }
+    return (slower == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,378 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/** @file chip.h
+ ** @brief Reemplazo de la biblioteca LPCOpen para compilar la aplicacion en la computadora de desarrollo.
+ **
+ ** Los puertos GPIO se modelan en memoria con la misma disposicion de registros que el LPC43xx. Como una escritura en
+ ** memoria no tiene efectos secundarios, cada acceso a traves de LPC_GPIO_PORT aplica primero las escrituras pendientes
+ ** en los registros SET, CLR, NOT, B, W, PIN y MPIN y recalcula los valores que se leen, de forma que el codigo de la
+ ** aplicacion ve el mismo comportamiento que en el procesador. El SysTick es un contador virtual que llega a cero y se
+ ** recarga cada vez que la aplicacion ejecuta __WFI, de modo que el tiempo simulado avanza un periodo del SysTick por
+ ** cada espera. La EEPROM es un arreglo en memoria que la simulacion puede respaldar en un archivo, cada programacion
+ ** de una pagina la copia al archivo. El RTC cuenta segundos de ciclos simulados y __WFI tambien despierta con su
+ ** interrupcion. Sus registros y los registros con respaldo de bateria se pueden guardar en otro archivo, como si la
+ ** bateria los conservara entre arranques.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define __I  volatile const
+#define __O  volatile
+#define __IO volatile
+
+//! Cantidad de puertos GPIO del LPC43xx
+#define SIM_GPIO_PORTS 8
+
+//! Cantidad de grupos de pines del SCU del LPC43xx
+#define SIM_SCU_PORTS  16
+
+//! Cantidad de pines de cada grupo del SCU
+#define SIM_SCU_PINS   32
+
+#ifdef SIM_GPIO_DIRECT
+//! Puertos GPIO como memoria comun, sin modelo de escrituras, para medir solo el costo del codigo de la aplicacion
+#define LPC_GPIO_PORT (&sim_gpio)
+#else
+//! Puertos GPIO, cada acceso aplica antes las escrituras pendientes del acceso anterior
+#define LPC_GPIO_PORT (SimGpioSync(), &sim_gpio)
+#endif
+
+#define SCU_MODE_FUNC0     0x0
+#define SCU_MODE_FUNC1     0x1
+#define SCU_MODE_FUNC2     0x2
+#define SCU_MODE_FUNC3     0x3
+#define SCU_MODE_FUNC4     0x4
+#define SCU_MODE_FUNC5     0x5
+#define SCU_MODE_FUNC6     0x6
+#define SCU_MODE_FUNC7     0x7
+#define SCU_MODE_PULLUP    (0x0 << 3)
+#define SCU_MODE_REPEATER  (0x1 << 3)
+#define SCU_MODE_INACT     (0x2 << 3)
+#define SCU_MODE_PULLDOWN  (0x3 << 3)
+#define SCU_MODE_HIGHSPEEDSLEW_EN (0x1 << 5)
+#define SCU_MODE_INBUFF_EN (0x1 << 6)
+#define SCU_MODE_ZIF_DIS   (0x1 << 7)
+
+#define __NVIC_PRIO_BITS 3
+
+//! Registros del SysTick
+#define SysTick (&sim_systick)
+
+//! Registros de control del sistema
+#define SCB (&sim_scb)
+
+//! Controlador de la EEPROM
+#define LPC_EEPROM (&sim_eeprom_registers)
+
+//! Cantidad de paginas de la EEPROM del LPC43xx
+#define EEPROM_PAGE_NUM  128
+
+//! Cantidad de bytes de una pagina de la EEPROM
+#define EEPROM_PAGE_SIZE 128
+
+//! Direccion de un byte de la EEPROM, en la simulacion es la del modelo en memoria
+#define EEPROM_ADDRESS(page, offset) ((uintptr_t)&sim_eeprom[page][offset])
+
+//! Reloj de tiempo real
+#define LPC_RTC (&sim_rtc)
+
+//! Registros con respaldo de bateria
+#define LPC_REGFILE (&sim_regfile)
+
+//! Timer que captura los pulsos de referencia, es el unico que tiene modelo
+#define LPC_TIMER2 (&sim_timer2)
+
+//! Cantidad de registros con respaldo de bateria
+#define SIM_REGFILE_SIZE 64
+
+#define RTC_AMR_CIIR_IMSEC       (1 << 0)
+#define RTC_INT_COUNTER_INCREASE (1 << 0)
+#define RTC_INT_ALARM            (1 << 1)
+#define RTC_CCR_CLKEN            (1 << 0)
+
+#define TIMER_ENABLE             (1 << 0)
+#define TIMER_RESET              (1 << 1)
+#define TIMER_CAP_RISING(n)      (1 << (3 * (n)))
+#define TIMER_INT_ON_CAP(n)      (1 << (3 * (n) + 2))
+#define TIMER_CAP_INT(n)         (1 << (4 + (n)))
+
+#define EEPROM_AUTOPROG_OFF  0
+#define EEPROM_INT_ENDOFPROG (1 << 2)
+
+#define SysTick_CTRL_ENABLE_Msk   (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk  (1UL << 1)
+#define SCB_ICSR_PENDSTSET_Msk    (1UL << 26)
+
+/* === Public data type declarations =============================================================================== */
+
+typedef enum {
+    DISABLE = 0,
+    ENABLE = 1,
+} FunctionalState;
+
+//! Campos de la hora y la fecha del RTC
+typedef enum {
+    RTC_TIMETYPE_SECOND,
+    RTC_TIMETYPE_MINUTE,
+    RTC_TIMETYPE_HOUR,
+    RTC_TIMETYPE_DAYOFMONTH,
+    RTC_TIMETYPE_DAYOFWEEK,
+    RTC_TIMETYPE_DAYOFYEAR,
+    RTC_TIMETYPE_MONTH,
+    RTC_TIMETYPE_YEAR,
+    RTC_TIMETYPE_LAST,
+} RTC_TIMEINDEX_T;
+
+//! Hora y fecha completas del RTC
+typedef struct {
+    uint32_t time[RTC_TIMETYPE_LAST];
+} RTC_TIME_T;
+
+//! Registros de los puertos GPIO, con la misma disposicion que en el LPC43xx
+typedef struct {
+    __IO uint8_t B[128][32];
+    __IO uint32_t W[32][32];
+    uint32_t RESERVED0[1024];
+    __IO uint32_t DIR[32];
+    __IO uint32_t MASK[32];
+    __IO uint32_t PIN[32];
+    __IO uint32_t MPIN[32];
+    __IO uint32_t SET[32];
+    __O uint32_t CLR[32];
+    __O uint32_t NOT[32];
+} LPC_GPIO_T;
+
+//! Registros del SysTick, con la misma disposicion que en el Cortex-M4
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t LOAD;
+    __IO uint32_t VAL;
+    __I uint32_t CALIB;
+} SysTick_Type;
+
+//! Registros de control del sistema, solo los que usa la aplicacion
+typedef struct {
+    __I uint32_t CPUID;
+    __IO uint32_t ICSR;
+} SCB_Type;
+
+//! Registros del controlador de la EEPROM, solo los que usa la aplicacion
+typedef struct {
+    __IO uint32_t CMD;
+    __IO uint32_t AUTOPROG;
+} LPC_EEPROM_T;
+
+//! Registros del RTC, solo los que usa la aplicacion y con la hora en un vector de campos
+typedef struct {
+    __IO uint32_t ILR;
+    __IO uint32_t CCR;
+    __IO uint32_t CIIR;
+    __IO uint32_t TIME[RTC_TIMETYPE_LAST];
+} LPC_RTC_T;
+
+//! Registros de un timer, con la misma disposicion que en el LPC43xx hasta los registros de captura
+typedef struct {
+    __IO uint32_t IR;
+    __IO uint32_t TCR;
+    __IO uint32_t TC;
+    __IO uint32_t PR;
+    __IO uint32_t PC;
+    __IO uint32_t MCR;
+    __IO uint32_t MR[4];
+    __IO uint32_t CCR;
+    __IO uint32_t CR[4];
+} LPC_TIMER_T;
+
+//! Relojes de los perifericos, solo los que usa la aplicacion
+typedef enum {
+    CLK_MX_TIMER2,
+} CHIP_CCU_CLK_T;
+
+//! Registros con respaldo de bateria
+typedef struct {
+    __IO uint32_t REGFILE[SIM_REGFILE_SIZE];
+} LPC_REGFILE_T;
+
+//! Numeros de interrupcion usados por la aplicacion
+typedef enum {
+    SysTick_IRQn = -1,
+    PIN_INT0_IRQn = 32,
+    TIMER2_IRQn = 14,
+    RTC_IRQn = 47,
+} IRQn_Type;
+
+/* === Public variable declarations ================================================================================ */
+
+//! Modelo en memoria de los registros de los puertos GPIO
+extern LPC_GPIO_T sim_gpio;
+
+//! Modo configurado en cada pin del SCU
+extern uint16_t sim_scu[SIM_SCU_PORTS][SIM_SCU_PINS];
+
+//! Modelo en memoria de los registros del SysTick
+extern SysTick_Type sim_systick;
+
+//! Modelo en memoria de los registros de control del sistema
+extern SCB_Type sim_scb;
+
+//! Modelo en memoria de los registros del controlador de la EEPROM
+extern LPC_EEPROM_T sim_eeprom_registers;
+
+//! Modelo en memoria del contenido de la EEPROM, las escrituras se guardan en el archivo al programar la pagina
+extern uint8_t sim_eeprom[EEPROM_PAGE_NUM][EEPROM_PAGE_SIZE];
+
+//! Modelo en memoria de los registros del RTC
+extern LPC_RTC_T sim_rtc;
+
+//! Modelo en memoria de los registros con respaldo de bateria
+extern LPC_REGFILE_T sim_regfile;
+
+//! Modelo en memoria de los registros del timer 2, la cuenta se calcula al capturar
+extern LPC_TIMER_T sim_timer2;
+
+//! Frecuencia del procesador simulado
+extern uint32_t SystemCoreClock;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Aplica las escrituras pendientes en los registros GPIO y recalcula los registros de lectura.
+ */
+void SimGpioSync(void);
+
+void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t mode);
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting);
+
+bool Chip_GPIO_GetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output);
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+void Chip_GPIO_SetPortOutLow(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask);
+
+void Chip_GPIO_SetPortDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask);
+
+void Chip_GPIO_SetPortDIRInput(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask);
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin);
+
+void Chip_EEPROM_Init(LPC_EEPROM_T * eeprom);
+
+void Chip_EEPROM_SetAutoProg(LPC_EEPROM_T * eeprom, uint32_t mode);
+
+/**
+ * @brief Programa las paginas de la EEPROM que se modificaron, en la simulacion las copia al archivo de respaldo.
+ */
+void Chip_EEPROM_EraseProgramPage(LPC_EEPROM_T * eeprom);
+
+void Chip_EEPROM_WaitForIntStatus(LPC_EEPROM_T * eeprom, uint32_t mask);
+
+/**
+ * @brief Arranca el oscilador del RTC con la cuenta detenida, conserva la hora y los registros con respaldo.
+ */
+void Chip_RTC_Init(LPC_RTC_T * rtc);
+
+void Chip_RTC_Enable(LPC_RTC_T * rtc, FunctionalState state);
+
+/**
+ * @brief Reinicia el divisor del cristal, el proximo segundo se completa un segundo despues.
+ */
+void Chip_RTC_ResetClockTickCounter(LPC_RTC_T * rtc);
+
+void Chip_RTC_GetFullTime(LPC_RTC_T * rtc, RTC_TIME_T * time);
+
+void Chip_RTC_SetFullTime(LPC_RTC_T * rtc, const RTC_TIME_T * time);
+
+/**
+ * @brief Escribe un solo campo de la hora o la fecha, sin detener la cuenta ni reiniciar el segundo en curso.
+ */
+void Chip_RTC_SetTime(LPC_RTC_T * rtc, RTC_TIMEINDEX_T type, uint32_t value);
+
+void Chip_RTC_CntIncrIntConfig(LPC_RTC_T * rtc, uint32_t mask, FunctionalState state);
+
+void Chip_RTC_ClearIntPending(LPC_RTC_T * rtc, uint32_t mask);
+
+uint32_t Chip_REGFILE_Read(LPC_REGFILE_T * regfile, int index);
+
+void Chip_REGFILE_Write(LPC_REGFILE_T * regfile, int index, uint32_t value);
+
+/**
+ * @brief Frecuencia del reloj de un periferico, en la simulacion todos cuentan con el reloj del procesador.
+ */
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clock);
+void Chip_TIMER_Init(LPC_TIMER_T * timer);
+void Chip_TIMER_Reset(LPC_TIMER_T * timer);
+void Chip_TIMER_Enable(LPC_TIMER_T * timer);
+void Chip_TIMER_PrescaleSet(LPC_TIMER_T * timer, uint32_t prescale);
+void Chip_TIMER_CaptureRisingEdgeEnable(LPC_TIMER_T * timer, int8_t capture);
+void Chip_TIMER_CaptureEnableInt(LPC_TIMER_T * timer, int8_t capture);
+void Chip_TIMER_ClearCapture(LPC_TIMER_T * timer, int8_t capture);
+uint32_t Chip_TIMER_ReadCapture(LPC_TIMER_T * timer, int8_t capture);
+
+void SystemCoreClockUpdate(void);
+
+uint32_t SysTick_Config(uint32_t ticks);
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+
+void NVIC_DisableIRQ(IRQn_Type irq);
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+void __disable_irq(void);
+
+void __enable_irq(void);
+
+/**
+ * @brief Espera la proxima interrupcion, en la simulacion avanza hasta que vence el SysTick, el RTC completa un
+ * segundo o llega un pulso de referencia y ejecuta la interrupcion correspondiente.
+ *
+ * Con las interrupciones deshabilitadas la interrupcion queda pendiente y se ejecuta en __enable_irq.
+ */
+void __WFI(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP_H_ */
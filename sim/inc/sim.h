@@ -0,0 +1,136 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SIM_H_
+#define SIM_H_
+
+/** @file sim.h
+ ** @brief Declaraciones del nucleo de la simulacion de la placa en la computadora de desarrollo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Fija el nivel electrico de un pin configurado como entrada.
+ *
+ * @param port Numero de puerto GPIO.
+ * @param bit Numero de bit dentro del puerto.
+ * @param level Nivel del pin.
+ */
+void SimGpioSetInput(uint8_t port, uint8_t bit, bool level);
+
+/**
+ * @brief Lee el estado de los pines de un puerto, tal como los veria un instrumento externo.
+ *
+ * @param port Numero de puerto GPIO.
+ * @return uint32_t Estado de los pines, las salidas toman el valor escrito y las entradas el nivel fijado.
+ */
+uint32_t SimGpioRead(uint8_t port);
+
+/**
+ * @brief Indica cuantos ciclos del procesador simulado transcurrieron.
+ *
+ * @return uint64_t Cantidad de ciclos desde que se configuro el SysTick, el tiempo se obtiene con SystemCoreClock.
+ */
+uint64_t SimCycles(void);
+
+/**
+ * @brief Respalda la EEPROM simulada en un archivo, que se lee al llamar y se actualiza en cada programacion.
+ *
+ * Se llama antes de arrancar la aplicacion. Sin archivo la EEPROM arranca borrada y no se conserva.
+ *
+ * @param path Nombre del archivo, se crea si no existe.
+ * @param erase true para descartar el contenido del archivo y arrancar con la EEPROM borrada.
+ * @return int 0 si se pudo abrir el archivo, -1 si hubo un error.
+ */
+int SimEepromAttach(const char * path, bool erase);
+
+/**
+ * @brief Respalda el RTC y los registros con respaldo de bateria en un archivo, como si tuvieran bateria.
+ *
+ * Se llama antes de arrancar la aplicacion. El archivo se lee al llamar y se actualiza al terminar la simulacion, el
+ * arranque siguiente sigue desde la hora y la fraccion de segundo en que termino el anterior. Sin archivo el RTC
+ * arranca detenido, como si se hubiera quedado sin bateria.
+ *
+ * @param path Nombre del archivo, se crea si no existe.
+ * @param erase true para descartar el contenido del archivo y arrancar sin bateria.
+ * @return int 0 si se pudo abrir el archivo, -1 si hubo un error.
+ */
+int SimRtcAttach(const char * path, bool erase);
+
+/**
+ * @brief Empieza a generar un pulso de referencia por segundo en la entrada de captura del timer 2.
+ *
+ * El tiempo de la simulacion lo marca el cristal de la placa y los pulsos llegan cada 1 + ppm / 10^6 segundos de ese
+ * tiempo, como si el cristal fuera ppm partes por millon mas rapido que la referencia.
+ *
+ * @param ppm Error del cristal de la placa, en partes por millon.
+ */
+void SimReferenceStart(int32_t ppm);
+
+/**
+ * @brief Deja de generar los pulsos de referencia, como si se desconectara la referencia.
+ */
+void SimReferenceStop(void);
+
+/**
+ * @brief Simula un corte de alimentacion durante la proxima programacion de la EEPROM.
+ *
+ * La pagina queda borrada y programada solo hasta la mitad de los bytes escritos, luego se llama a SimPowerLoss.
+ */
+void SimEepromPowerFail(void);
+
+/**
+ * @brief Funcion que la simulacion ejecuta cuando se corta la alimentacion, la implementa el programa de prueba.
+ */
+void SimPowerLoss(void);
+
+/**
+ * @brief Funcion que la simulacion ejecuta despues de cada interrupcion del SysTick, la implementa el programa de
+ * prueba.
+ */
+void SimTickHook(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_H_ */
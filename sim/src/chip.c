@@ -0,0 +1,678 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip.c
+ ** @brief Codigo fuente del modelo en memoria de los perifericos del LPC43xx usados por la aplicacion.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include "sim.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Frecuencia del procesador de la placa EDU-CIAA
+#define SIM_CORE_CLOCK 204000000
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado de un puerto GPIO que no se ve en sus registros
+struct sim_port_s {
+    uint32_t latch;      // valor escrito en las salidas
+    uint32_t inputs;     // nivel fijado en los pines de entrada
+    uint32_t pin;        // valor que se dejo en el registro PIN
+    uint32_t mpin;       // valor que se dejo en el registro MPIN
+    uint8_t b[32];       // valores que se dejaron en los registros B
+    uint32_t w[32];      // valores que se dejaron en los registros W
+    bool stale;          // indica que hay que reescribir los registros B y W aunque no cambien los pines
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Aplica a la salida de un puerto las escrituras que se hicieron en sus registros desde el ultimo acceso.
+ *
+ * @param index Numero de puerto GPIO.
+ */
+static void SimGpioFold(uint8_t index);
+
+/**
+ * @brief Recalcula los registros de lectura de un puerto a partir de sus salidas, entradas y direcciones.
+ *
+ * @param index Numero de puerto GPIO.
+ */
+static void SimGpioRefresh(uint8_t index);
+
+/**
+ * @brief Atiende la interrupcion pendiente del SysTick y avisa al programa de prueba.
+ */
+static void SimSysTickService(void);
+
+/**
+ * @brief Avanza un segundo la hora del RTC y pide su interrupcion si esta habilitada.
+ */
+static void SimRtcSecond(void);
+
+/**
+ * @brief Atiende el pedido de interrupcion del RTC, si esta habilitada en el NVIC.
+ */
+static void SimRtcService(void);
+
+/**
+ * @brief Guarda los registros del RTC y los registros con respaldo de bateria en el archivo de respaldo.
+ */
+static void SimRtcSave(void);
+
+/**
+ * @brief Captura la cuenta del timer 2 al llegar un pulso de referencia y pide su interrupcion si esta habilitada.
+ */
+static void SimReferencePulse(void);
+
+/**
+ * @brief Atiende el pedido de interrupcion del timer 2, si esta habilitada en el NVIC.
+ */
+static void SimTimerService(void);
+
+/**
+ * @brief Rutina de interrupcion del SysTick, definida por la aplicacion.
+ */
+void SysTick_Handler(void);
+
+/**
+ * @brief Rutina de interrupcion del RTC, la aplicacion solo la define si usa el RTC como base de tiempo.
+ */
+void RTC_IRQHandler(void) __attribute__((weak));
+
+/**
+ * @brief Rutina de interrupcion del timer 2, la aplicacion solo la define si captura los pulsos de referencia.
+ */
+void TIMER2_IRQHandler(void) __attribute__((weak));
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado interno de cada puerto GPIO
+static struct sim_port_s ports[SIM_GPIO_PORTS];
+
+//! Ciclos del procesador simulados desde que se configuro el SysTick
+static uint64_t cycles;
+
+//! Indica si las interrupciones estan habilitadas
+static bool irq_enabled = true;
+
+//! Contenido de la EEPROM que ya se programo, para encontrar las paginas modificadas
+static uint8_t eeprom_programmed[EEPROM_PAGE_NUM][EEPROM_PAGE_SIZE];
+
+//! Archivo de respaldo de la EEPROM, NULL si el contenido no se conserva
+static FILE * eeprom_file;
+
+//! Indica que la proxima programacion de la EEPROM se corta a la mitad
+static bool eeprom_power_fail;
+
+//! Ciclos que faltan para que el RTC complete el segundo en curso
+static uint32_t rtc_remaining = SIM_CORE_CLOCK;
+
+//! Indica si la interrupcion del RTC esta habilitada en el NVIC
+static bool rtc_irq_enabled;
+
+//! Archivo de respaldo del RTC y de los registros con respaldo de bateria, NULL si no se conservan
+static FILE * rtc_file;
+
+//! Ciclo en que se reinicio la cuenta del timer 2
+static uint64_t timer_start;
+
+//! Indica si la interrupcion del timer 2 esta habilitada en el NVIC
+static bool timer_irq_enabled;
+
+//! Ciclos entre dos pulsos de referencia, 0 si no llegan pulsos
+static uint32_t reference_period;
+
+//! Ciclos que faltan para el proximo pulso de referencia
+static uint32_t reference_remaining;
+
+/* === Public variable definitions ================================================================================= */
+
+LPC_GPIO_T sim_gpio;
+
+uint16_t sim_scu[SIM_SCU_PORTS][SIM_SCU_PINS];
+
+SysTick_Type sim_systick;
+
+SCB_Type sim_scb;
+
+LPC_EEPROM_T sim_eeprom_registers;
+
+uint8_t sim_eeprom[EEPROM_PAGE_NUM][EEPROM_PAGE_SIZE];
+
+LPC_RTC_T sim_rtc;
+
+LPC_REGFILE_T sim_regfile;
+
+LPC_TIMER_T sim_timer2;
+
+uint32_t SystemCoreClock;
+
+/* === Private function definitions ================================================================================ */
+
+static void SimGpioFold(uint8_t index) {
+    struct sim_port_s * port = &ports[index];
+    uint32_t latch = port->latch;
+
+    if (sim_gpio.SET[index]) {
+        latch |= sim_gpio.SET[index];
+        sim_gpio.SET[index] = 0;
+    }
+    if (sim_gpio.CLR[index]) {
+        latch &= ~sim_gpio.CLR[index];
+        sim_gpio.CLR[index] = 0;
+    }
+    if (sim_gpio.NOT[index]) {
+        latch ^= sim_gpio.NOT[index];
+        sim_gpio.NOT[index] = 0;
+    }
+    if (sim_gpio.PIN[index] != port->pin) {
+        latch = sim_gpio.PIN[index];
+    }
+    // Solo cambian los bits habilitados en MASK, una escritura igual al valor leido no modifica nada
+    if (sim_gpio.MPIN[index] != port->mpin) {
+        latch = (latch & sim_gpio.MASK[index]) | (sim_gpio.MPIN[index] & ~sim_gpio.MASK[index]);
+    }
+    if (memcmp((const void *)sim_gpio.B[index], port->b, sizeof(port->b)) != 0) {
+        for (uint8_t bit = 0; bit < 32; bit++) {
+            if (sim_gpio.B[index][bit] != port->b[bit]) {
+                latch = (sim_gpio.B[index][bit] & 1) ? (latch | (1UL << bit)) : (latch & ~(1UL << bit));
+            }
+        }
+        port->stale = true;
+    }
+    if (memcmp((const void *)sim_gpio.W[index], port->w, sizeof(port->w)) != 0) {
+        for (uint8_t bit = 0; bit < 32; bit++) {
+            if (sim_gpio.W[index][bit] != port->w[bit]) {
+                latch = sim_gpio.W[index][bit] ? (latch | (1UL << bit)) : (latch & ~(1UL << bit));
+            }
+        }
+        port->stale = true;
+    }
+    port->latch = latch;
+}
+
+static void SimGpioRefresh(uint8_t index) {
+    struct sim_port_s * port = &ports[index];
+    uint32_t value = (port->latch & sim_gpio.DIR[index]) | (port->inputs & ~sim_gpio.DIR[index]);
+
+    // Los registros de bytes y palabras solo se reescriben cuando cambio el estado de algun pin
+    if ((value != port->pin) || port->stale) {
+        port->stale = false;
+        for (uint8_t bit = 0; bit < 32; bit++) {
+            port->b[bit] = (value >> bit) & 1;
+            port->w[bit] = port->b[bit] ? 0xFFFFFFFF : 0;
+        }
+        memcpy((void *)sim_gpio.B[index], port->b, sizeof(port->b));
+        memcpy((void *)sim_gpio.W[index], port->w, sizeof(port->w));
+    }
+    port->pin = value;
+    port->mpin = value & ~sim_gpio.MASK[index];
+    sim_gpio.PIN[index] = port->pin;
+    sim_gpio.MPIN[index] = port->mpin;
+}
+
+static void SimSysTickService(void) {
+    sim_scb.ICSR &= ~SCB_ICSR_PENDSTSET_Msk;
+    SysTick_Handler();
+    SimTickHook();
+}
+
+static void SimRtcSecond(void) {
+    // Solo se lleva la hora y el dia de la semana, la aplicacion no usa la fecha
+    if (++sim_rtc.TIME[RTC_TIMETYPE_SECOND] == 60) {
+        sim_rtc.TIME[RTC_TIMETYPE_SECOND] = 0;
+        if (++sim_rtc.TIME[RTC_TIMETYPE_MINUTE] == 60) {
+            sim_rtc.TIME[RTC_TIMETYPE_MINUTE] = 0;
+            if (++sim_rtc.TIME[RTC_TIMETYPE_HOUR] == 24) {
+                sim_rtc.TIME[RTC_TIMETYPE_HOUR] = 0;
+                if (++sim_rtc.TIME[RTC_TIMETYPE_DAYOFWEEK] == 7) {
+                    sim_rtc.TIME[RTC_TIMETYPE_DAYOFWEEK] = 0;
+                }
+            }
+        }
+    }
+    if (sim_rtc.CIIR & RTC_AMR_CIIR_IMSEC) {
+        sim_rtc.ILR |= RTC_INT_COUNTER_INCREASE;
+    }
+}
+
+static void SimRtcService(void) {
+    if (rtc_irq_enabled && (sim_rtc.ILR & RTC_INT_COUNTER_INCREASE) && (RTC_IRQHandler != NULL)) {
+        RTC_IRQHandler();
+    }
+}
+
+static void SimRtcSave(void) {
+    if (rtc_file != NULL) {
+        rewind(rtc_file);
+        fwrite((const void *)&sim_rtc, sizeof(sim_rtc), 1, rtc_file);
+        fwrite((const void *)&sim_regfile, sizeof(sim_regfile), 1, rtc_file);
+        fwrite(&rtc_remaining, sizeof(rtc_remaining), 1, rtc_file);
+        fflush(rtc_file);
+    }
+}
+
+static void SimReferencePulse(void) {
+    if ((sim_timer2.TCR & TIMER_ENABLE) && (sim_timer2.CCR & TIMER_CAP_RISING(0))) {
+        sim_timer2.CR[0] = (uint32_t)((cycles - timer_start) / (sim_timer2.PR + 1));
+        if (sim_timer2.CCR & TIMER_INT_ON_CAP(0)) {
+            sim_timer2.IR |= TIMER_CAP_INT(0);
+        }
+    }
+}
+
+static void SimTimerService(void) {
+    if (timer_irq_enabled && (sim_timer2.IR & TIMER_CAP_INT(0)) && (TIMER2_IRQHandler != NULL)) {
+        TIMER2_IRQHandler();
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void SimGpioSync(void) {
+    for (uint8_t index = 0; index < SIM_GPIO_PORTS; index++) {
+        SimGpioFold(index);
+        SimGpioRefresh(index);
+    }
+}
+
+void SimGpioSetInput(uint8_t port, uint8_t bit, bool level) {
+    SimGpioSync();
+    if (level) {
+        ports[port].inputs |= (1UL << bit);
+    } else {
+        ports[port].inputs &= ~(1UL << bit);
+    }
+    SimGpioRefresh(port);
+}
+
+uint32_t SimGpioRead(uint8_t port) {
+    SimGpioSync();
+    return ports[port].pin;
+}
+
+uint64_t SimCycles(void) {
+    return cycles;
+}
+
+int SimEepromAttach(const char * path, bool erase) {
+    eeprom_file = erase ? NULL : fopen(path, "r+b");
+    if (eeprom_file != NULL) {
+        // Un archivo mas corto deja el resto de la EEPROM borrada
+        if (fread(sim_eeprom, 1, sizeof(sim_eeprom), eeprom_file) != sizeof(sim_eeprom)) {
+            clearerr(eeprom_file);
+        }
+    } else {
+        eeprom_file = fopen(path, "w+b");
+        if (eeprom_file == NULL) {
+            return -1;
+        }
+        memset(sim_eeprom, 0, sizeof(sim_eeprom));
+        fwrite(sim_eeprom, 1, sizeof(sim_eeprom), eeprom_file);
+        fflush(eeprom_file);
+    }
+    memcpy(eeprom_programmed, sim_eeprom, sizeof(sim_eeprom));
+    return 0;
+}
+
+int SimRtcAttach(const char * path, bool erase) {
+    rtc_file = erase ? NULL : fopen(path, "r+b");
+    if ((rtc_file == NULL) || (fread((void *)&sim_rtc, sizeof(sim_rtc), 1, rtc_file) != 1) ||
+        (fread((void *)&sim_regfile, sizeof(sim_regfile), 1, rtc_file) != 1) ||
+        (fread(&rtc_remaining, sizeof(rtc_remaining), 1, rtc_file) != 1)) {
+        // Sin archivo o con uno incompleto el RTC arranca como si se hubiera quedado sin bateria
+        if (rtc_file != NULL) {
+            fclose(rtc_file);
+        }
+        rtc_file = fopen(path, "w+b");
+        if (rtc_file == NULL) {
+            return -1;
+        }
+        memset((void *)&sim_rtc, 0, sizeof(sim_rtc));
+        memset((void *)&sim_regfile, 0, sizeof(sim_regfile));
+        rtc_remaining = SIM_CORE_CLOCK;
+    }
+    // Un pedido de interrupcion que quedo del arranque anterior no lo ve la aplicacion nueva
+    sim_rtc.ILR = 0;
+    // El RTC sigue contando hasta el final de la simulacion, su estado se guarda al salir
+    atexit(SimRtcSave);
+    SimRtcSave();
+    return 0;
+}
+
+void SimReferenceStart(int32_t ppm) {
+    // Con el cristal de la placa rapido pasan mas ciclos entre dos pulsos de la referencia
+    reference_period = (uint32_t)((int64_t)SIM_CORE_CLOCK + ((int64_t)SIM_CORE_CLOCK * ppm) / 1000000);
+    reference_remaining = reference_period;
+}
+
+void SimReferenceStop(void) {
+    reference_period = 0;
+}
+
+void SimEepromPowerFail(void) {
+    eeprom_power_fail = true;
+}
+
+void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t mode) {
+    if ((port < SIM_SCU_PORTS) && (pin < SIM_SCU_PINS)) {
+        sim_scu[port][pin] = mode;
+    }
+}
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting) {
+    (void)gpio;
+    if (setting) {
+        ports[port].latch |= (1UL << pin);
+    } else {
+        ports[port].latch &= ~(1UL << pin);
+    }
+    SimGpioRefresh(port);
+}
+
+bool Chip_GPIO_GetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    (void)gpio;
+    return (ports[port].pin >> pin) & 1;
+}
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output) {
+    (void)gpio;
+    if (output) {
+        sim_gpio.DIR[port] |= (1UL << pin);
+    } else {
+        sim_gpio.DIR[port] &= ~(1UL << pin);
+    }
+    SimGpioRefresh(port);
+}
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    (void)gpio;
+    ports[port].latch ^= (1UL << pin);
+    SimGpioRefresh(port);
+}
+
+void Chip_GPIO_SetPortOutLow(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    (void)gpio;
+    ports[port].latch &= ~mask;
+    SimGpioRefresh(port);
+}
+
+void Chip_GPIO_SetPortDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    (void)gpio;
+    sim_gpio.DIR[port] |= mask;
+    SimGpioRefresh(port);
+}
+
+void Chip_GPIO_SetPortDIRInput(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    (void)gpio;
+    sim_gpio.DIR[port] &= ~mask;
+    SimGpioRefresh(port);
+}
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin) {
+    return Chip_GPIO_GetPinState(gpio, port, pin);
+}
+
+void Chip_EEPROM_Init(LPC_EEPROM_T * eeprom) {
+    (void)eeprom;
+}
+
+void Chip_EEPROM_SetAutoProg(LPC_EEPROM_T * eeprom, uint32_t mode) {
+    eeprom->AUTOPROG = mode;
+}
+
+void Chip_EEPROM_EraseProgramPage(LPC_EEPROM_T * eeprom) {
+    // El modelo no sabe que pagina se escribio, programa todas las que difieren de lo que ya estaba programado
+    for (uint16_t page = 0; page < EEPROM_PAGE_NUM; page++) {
+        if (memcmp(sim_eeprom[page], eeprom_programmed[page], EEPROM_PAGE_SIZE) == 0) {
+            continue;
+        }
+        if (eeprom_power_fail) {
+            uint16_t written = EEPROM_PAGE_SIZE;
+
+            // La pagina llega a borrarse pero solo se programa la primera mitad de lo que se habia escrito
+            while (sim_eeprom[page][written - 1] == eeprom_programmed[page][written - 1]) {
+                written--;
+            }
+            memset(eeprom_programmed[page], 0, EEPROM_PAGE_SIZE);
+            memcpy(eeprom_programmed[page], sim_eeprom[page], written / 2);
+        } else {
+            memcpy(eeprom_programmed[page], sim_eeprom[page], EEPROM_PAGE_SIZE);
+        }
+        if (eeprom_file != NULL) {
+            fseek(eeprom_file, (long)page * EEPROM_PAGE_SIZE, SEEK_SET);
+            fwrite(eeprom_programmed[page], 1, EEPROM_PAGE_SIZE, eeprom_file);
+            fflush(eeprom_file);
+        }
+        if (eeprom_power_fail) {
+            eeprom_power_fail = false;
+            SimPowerLoss();
+        }
+    }
+    eeprom->CMD = 0;
+}
+
+void Chip_EEPROM_WaitForIntStatus(LPC_EEPROM_T * eeprom, uint32_t mask) {
+    (void)eeprom;
+    (void)mask;
+}
+
+void Chip_RTC_Init(LPC_RTC_T * rtc) {
+    rtc->CCR = 0;
+    rtc->CIIR = 0;
+    rtc->ILR = 0;
+    rtc_remaining = SIM_CORE_CLOCK;
+}
+
+void Chip_RTC_Enable(LPC_RTC_T * rtc, FunctionalState state) {
+    if (state == ENABLE) {
+        rtc->CCR |= RTC_CCR_CLKEN;
+    } else {
+        rtc->CCR &= ~RTC_CCR_CLKEN;
+    }
+}
+
+void Chip_RTC_ResetClockTickCounter(LPC_RTC_T * rtc) {
+    (void)rtc;
+    rtc_remaining = SIM_CORE_CLOCK;
+}
+
+void Chip_RTC_GetFullTime(LPC_RTC_T * rtc, RTC_TIME_T * time) {
+    for (uint8_t field = 0; field < RTC_TIMETYPE_LAST; field++) {
+        time->time[field] = rtc->TIME[field];
+    }
+}
+
+void Chip_RTC_SetFullTime(LPC_RTC_T * rtc, const RTC_TIME_T * time) {
+    for (uint8_t field = 0; field < RTC_TIMETYPE_LAST; field++) {
+        rtc->TIME[field] = time->time[field];
+    }
+}
+
+void Chip_RTC_SetTime(LPC_RTC_T * rtc, RTC_TIMEINDEX_T type, uint32_t value) {
+    rtc->TIME[type] = value;
+}
+
+void Chip_RTC_CntIncrIntConfig(LPC_RTC_T * rtc, uint32_t mask, FunctionalState state) {
+    if (state == ENABLE) {
+        rtc->CIIR |= mask;
+    } else {
+        rtc->CIIR &= ~mask;
+    }
+}
+
+void Chip_RTC_ClearIntPending(LPC_RTC_T * rtc, uint32_t mask) {
+    rtc->ILR &= ~mask;
+}
+
+uint32_t Chip_REGFILE_Read(LPC_REGFILE_T * regfile, int index) {
+    return regfile->REGFILE[index];
+}
+
+void Chip_REGFILE_Write(LPC_REGFILE_T * regfile, int index, uint32_t value) {
+    regfile->REGFILE[index] = value;
+}
+
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clock) {
+    (void)clock;
+    return SIM_CORE_CLOCK;
+}
+
+void Chip_TIMER_Init(LPC_TIMER_T * timer) {
+    (void)timer;
+}
+
+void Chip_TIMER_Reset(LPC_TIMER_T * timer) {
+    timer->TC = 0;
+    timer_start = cycles;
+}
+
+void Chip_TIMER_Enable(LPC_TIMER_T * timer) {
+    timer->TCR |= TIMER_ENABLE;
+}
+
+void Chip_TIMER_PrescaleSet(LPC_TIMER_T * timer, uint32_t prescale) {
+    timer->PR = prescale;
+}
+
+void Chip_TIMER_CaptureRisingEdgeEnable(LPC_TIMER_T * timer, int8_t capture) {
+    timer->CCR |= TIMER_CAP_RISING(capture);
+}
+
+void Chip_TIMER_CaptureEnableInt(LPC_TIMER_T * timer, int8_t capture) {
+    timer->CCR |= TIMER_INT_ON_CAP(capture);
+}
+
+void Chip_TIMER_ClearCapture(LPC_TIMER_T * timer, int8_t capture) {
+    timer->IR &= ~TIMER_CAP_INT(capture);
+}
+
+uint32_t Chip_TIMER_ReadCapture(LPC_TIMER_T * timer, int8_t capture) {
+    return timer->CR[capture];
+}
+
+void SystemCoreClockUpdate(void) {
+    SystemCoreClock = SIM_CORE_CLOCK;
+}
+
+uint32_t SysTick_Config(uint32_t ticks) {
+    sim_systick.LOAD = ticks - 1;
+    sim_systick.VAL = sim_systick.LOAD;
+    sim_systick.CTRL = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk;
+    cycles = 0;
+    return 0;
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {
+    (void)irq;
+    (void)priority;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq) {
+    if (irq == RTC_IRQn) {
+        rtc_irq_enabled = true;
+    } else if (irq == TIMER2_IRQn) {
+        timer_irq_enabled = true;
+    }
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq) {
+    if (irq == RTC_IRQn) {
+        rtc_irq_enabled = false;
+    } else if (irq == TIMER2_IRQn) {
+        timer_irq_enabled = false;
+    }
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+    (void)irq;
+}
+
+void __disable_irq(void) {
+    irq_enabled = false;
+}
+
+void __enable_irq(void) {
+    irq_enabled = true;
+    if (sim_scb.ICSR & SCB_ICSR_PENDSTSET_Msk) {
+        SimSysTickService();
+    }
+    SimRtcService();
+    SimTimerService();
+}
+
+void __WFI(void) {
+    uint32_t step;
+
+    if (!(sim_systick.CTRL & SysTick_CTRL_ENABLE_Msk)) {
+        SimTickHook();
+        return;
+    }
+    // El tiempo avanza hasta que el SysTick llega a cero, el RTC completa un segundo o llega un pulso de referencia,
+    // lo que ocurra primero
+    step = sim_systick.VAL + 1;
+    if ((sim_rtc.CCR & RTC_CCR_CLKEN) && (rtc_remaining < step)) {
+        step = rtc_remaining;
+    }
+    if (reference_period && (reference_remaining < step)) {
+        step = reference_remaining;
+    }
+    cycles += step;
+    if (sim_rtc.CCR & RTC_CCR_CLKEN) {
+        rtc_remaining -= step;
+        if (rtc_remaining == 0) {
+            rtc_remaining = SIM_CORE_CLOCK;
+            SimRtcSecond();
+        }
+    }
+    if (reference_period) {
+        reference_remaining -= step;
+        if (reference_remaining == 0) {
+            reference_remaining = reference_period;
+            SimReferencePulse();
+        }
+    }
+    if (step == sim_systick.VAL + 1) {
+        sim_systick.VAL = sim_systick.LOAD;
+        sim_scb.ICSR |= SCB_ICSR_PENDSTSET_Msk;
+    } else {
+        sim_systick.VAL -= step;
+    }
+    if (irq_enabled) {
+        if (sim_scb.ICSR & SCB_ICSR_PENDSTSET_Msk) {
+            SimSysTickService();
+        }
+        SimRtcService();
+        SimTimerService();
+    }
+}
+
+/* === End of documentation ======================================================================================== */
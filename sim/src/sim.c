@@ -0,0 +1,461 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file sim.c
+ ** @brief Programa que ejecuta la aplicacion del reloj sobre la placa simulada siguiendo un guion de pruebas.
+ **
+ ** El guion es un archivo de texto con una accion por linea, precedida por el tiempo virtual en milisegundos en que se
+ ** ejecuta. Las acciones no necesitan estar ordenadas, las que tienen el mismo tiempo se ejecutan en el orden del
+ ** guion. Las lineas vacias y las que empiezan con # se ignoran. Las acciones son:
+ **
+ ** - press <tecla> y release <tecla>: presiona o suelta f1, f2, f3, f4, accept o cancel.
+ ** - display <texto>: verifica lo que muestra la pantalla, con un caracter por digito seguido opcionalmente de un punto
+ **   y _ para un digito apagado, por ejemplo 12.34, ____ o SEt. Los caracteres se comparan por sus segmentos segun la
+ **   fuente de la pantalla, por lo que 5Et y SEt son equivalentes.
+ ** - led <red|green|blue|buzzer> <on|off>: verifica el estado de una salida.
+ ** - dump: muestra el estado de la pantalla y las salidas.
+ ** - eeprom <archivo> [erase]: respalda la EEPROM en el archivo, con erase la arranca borrada. Se aplica al leer el
+ **   guion, antes de arrancar la aplicacion, por lo que el tiempo no importa. Los guiones que usan el mismo archivo
+ **   comparten la configuracion guardada como si fueran arranques sucesivos de la placa.
+ ** - rtc <archivo> [erase]: respalda el RTC en el archivo como si tuviera bateria, con erase arranca sin bateria. Se
+ **   aplica al leer el guion como eeprom, los guiones que usan el mismo archivo siguen con la hora del anterior.
+ ** - pps <ppm|off>: desde ese momento llega un pulso de referencia por segundo a la entrada de captura, con el
+ **   cristal de la placa ppm partes por millon mas rapido que la referencia, o dejan de llegar pulsos con off.
+ ** - powerfail: corta la alimentacion durante la proxima programacion de la EEPROM, que queda a medias, y termina la
+ **   simulacion con el resultado de las verificaciones hechas hasta ese momento.
+ ** - end: termina la simulacion.
+ **
+ ** El programa termina con codigo 0 si todas las verificaciones fueron correctas y con 1 si alguna fallo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include "config.h"
+#include "poncho.h"
+#include "power.h"
+#include "profile.h"
+#include "screen.h"
+#include "sim.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de digitos de la pantalla del poncho
+#define SIM_DIGITS        4
+
+//! Cantidad maxima de acciones de un guion
+#define SIM_MAX_ACTIONS   1024
+
+//! Longitud maxima de una linea del guion
+#define SIM_LINE_SIZE     128
+
+//! Longitud maxima de los argumentos de una accion
+#define SIM_ARGUMENT_SIZE 16
+
+//! Longitud maxima del primer argumento de una accion, que puede ser la ruta de un archivo
+#define SIM_PATH_SIZE     64
+
+/* === Private data type declarations ============================================================================== */
+
+//! Accion del guion de pruebas
+struct sim_action_s {
+    uint32_t time;                       // tiempo virtual de la accion, en milisegundos
+    uint16_t line;                       // linea del guion, para los mensajes de error
+    char command[SIM_ARGUMENT_SIZE];     // nombre de la accion
+    char argument[SIM_PATH_SIZE];        // primer argumento
+    char value[SIM_ARGUMENT_SIZE];       // segundo argumento
+};
+
+//! Pin de la placa que el guion puede manejar o verificar por nombre
+struct sim_pin_s {
+    const char * name; // nombre del pin en el guion
+    uint8_t gpio;      // puerto GPIO
+    uint8_t bit;       // bit dentro del puerto
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Funcion principal de la aplicacion, que se compila con otro nombre para la simulacion.
+ */
+int app_main(void);
+
+/**
+ * @brief Lee un guion de pruebas.
+ *
+ * @param path Nombre del archivo, - para la entrada estandar.
+ * @return int 0 si el guion se leyo completo, -1 si hubo un error.
+ */
+static int SimLoadScript(const char * path);
+
+/**
+ * @brief Busca un pin por su nombre.
+ *
+ * @param pins Tabla de pines terminada con un nombre NULL.
+ * @param name Nombre a buscar.
+ * @return const struct sim_pin_s* Pin encontrado o NULL si no existe.
+ */
+static const struct sim_pin_s * SimFindPin(const struct sim_pin_s pins[], const char * name);
+
+/**
+ * @brief Registra el digito que esta encendido en la pantalla y sus segmentos.
+ */
+static void SimSampleDisplay(void);
+
+/**
+ * @brief Arma el texto que muestra la pantalla, con el mismo formato que la accion display.
+ *
+ * @param text Buffer donde se escribe el texto, de al menos 2 * SIM_DIGITS + 1 caracteres.
+ */
+static void SimDisplayText(char * text);
+
+/**
+ * @brief Convierte el texto de una accion display en los segmentos de cada digito, con la fuente de la pantalla.
+ *
+ * @param text Texto de la accion, con _ para un digito apagado.
+ * @param segments Vector donde se guardan los segmentos de cada digito.
+ * @return bool true si el texto tiene exactamente un caracter por digito.
+ */
+static bool SimDisplayParse(const char * text, uint8_t segments[SIM_DIGITS]);
+
+/**
+ * @brief Ejecuta una accion del guion.
+ *
+ * @param action Accion a ejecutar.
+ */
+static void SimExecute(const struct sim_action_s * action);
+
+/**
+ * @brief Muestra el estado de la pantalla y las salidas.
+ */
+static void SimDump(void);
+
+/**
+ * @brief Muestra una linea del volcado de tiempos de ejecucion.
+ *
+ * @param line Linea a mostrar.
+ */
+static void SimPrintLine(const char * line);
+
+/**
+ * @brief Termina la simulacion con el resultado de las verificaciones.
+ */
+static void SimFinish(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Teclas que el guion puede presionar, todas activas en alto
+static const struct sim_pin_s KEYS[] = {
+    {"f1", KEY_F1_GPIO, KEY_F1_BIT},
+    {"f2", KEY_F2_GPIO, KEY_F2_BIT},
+    {"f3", KEY_F3_GPIO, KEY_F3_BIT},
+    {"f4", KEY_F4_GPIO, KEY_F4_BIT},
+    {"accept", KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT},
+    {"cancel", KEY_CANCEL_GPIO, KEY_CANCEL_BIT},
+    {NULL, 0, 0},
+};
+
+//! Salidas que el guion puede verificar
+static const struct sim_pin_s OUTPUTS[] = {
+    {"red", PONCHO_RGB_RED_GPIO, PONCHO_RGB_RED_BIT},
+    {"green", PONCHO_RGB_GREEN_GPIO, PONCHO_RGB_GREEN_BIT},
+    {"blue", PONCHO_RGB_BLUE_GPIO, PONCHO_RGB_BLUE_BIT},
+    {"buzzer", BUZZER_GPIO, BUZZER_BIT},
+    {NULL, 0, 0},
+};
+
+//! Lineas de habilitacion de cada digito, el digito 0 es el de la izquierda
+static const uint32_t DIGIT_MASKS[SIM_DIGITS] = {DIGIT_4_MASK, DIGIT_3_MASK, DIGIT_2_MASK, DIGIT_1_MASK};
+
+//! Acciones del guion ordenadas por tiempo
+static struct sim_action_s actions[SIM_MAX_ACTIONS];
+
+//! Cantidad de acciones del guion
+static uint16_t actions_count;
+
+//! Proxima accion a ejecutar
+static uint16_t next_action;
+
+//! Segmentos que se vieron encendidos por ultima vez en cada digito
+static uint8_t display[SIM_DIGITS];
+
+//! Tiempo maximo de simulacion en milisegundos
+static uint32_t duration = UINT32_MAX;
+
+//! Cantidad de verificaciones que fallaron
+static uint16_t failures;
+
+//! Cantidad de verificaciones realizadas
+static uint16_t checks;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static int SimLoadScript(const char * path) {
+    FILE * file = (strcmp(path, "-") == 0) ? stdin : fopen(path, "r");
+    char line[SIM_LINE_SIZE];
+    uint16_t number = 0;
+    int result = 0;
+
+    if (file == NULL) {
+        fprintf(stderr, "sim: no se puede abrir %s\n", path);
+        return -1;
+    }
+    while ((result == 0) && fgets(line, sizeof(line), file)) {
+        struct sim_action_s * action = &actions[actions_count];
+        char * text = line + strspn(line, " \t");
+        unsigned long time;
+        int fields;
+
+        number++;
+        if ((*text == '#') || (*text == '\n') || (*text == '\0')) {
+            continue;
+        }
+        memset(action, 0, sizeof(*action));
+        fields = sscanf(text, "%lu %15s %63s %15s", &time, action->command, action->argument, action->value);
+        if ((fields < 2) || (actions_count >= SIM_MAX_ACTIONS)) {
+            fprintf(stderr, "sim: %s:%u: linea no valida\n", path, number);
+            result = -1;
+        } else if (strcmp(action->command, "eeprom") == 0) {
+            if (SimEepromAttach(action->argument, strcmp(action->value, "erase") == 0) != 0) {
+                fprintf(stderr, "sim: %s:%u: no se puede abrir %s\n", path, number, action->argument);
+                result = -1;
+            }
+        } else if (strcmp(action->command, "rtc") == 0) {
+            if (SimRtcAttach(action->argument, strcmp(action->value, "erase") == 0) != 0) {
+                fprintf(stderr, "sim: %s:%u: no se puede abrir %s\n", path, number, action->argument);
+                result = -1;
+            }
+        } else {
+            action->time = time;
+            action->line = number;
+            actions_count++;
+        }
+    }
+
+    // Las acciones se ordenan por tiempo respetando el orden del guion entre las que ocurren al mismo tiempo
+    for (uint16_t index = 1; index < actions_count; index++) {
+        struct sim_action_s action = actions[index];
+        uint16_t position = index;
+
+        while ((position > 0) && (actions[position - 1].time > action.time)) {
+            actions[position] = actions[position - 1];
+            position--;
+        }
+        actions[position] = action;
+    }
+    if (file != stdin) {
+        fclose(file);
+    }
+    return result;
+}
+
+static const struct sim_pin_s * SimFindPin(const struct sim_pin_s pins[], const char * name) {
+    for (uint8_t index = 0; pins[index].name != NULL; index++) {
+        if (strcmp(pins[index].name, name) == 0) {
+            return &pins[index];
+        }
+    }
+    return NULL;
+}
+
+static void SimSampleDisplay(void) {
+    uint32_t digits = SimGpioRead(DIGITS_GPIO) & DIGITS_MASK;
+    uint8_t segments = SimGpioRead(SEGMENTS_GPIO) & SEGMENTS_MASK;
+
+    if (SimGpioRead(SEGMENT_P_GPIO) & (1UL << SEGMENT_P_BIT)) {
+        segments |= SEGMENT_P;
+    }
+    for (uint8_t digit = 0; digit < SIM_DIGITS; digit++) {
+        if (digits == DIGIT_MASKS[digit]) {
+            display[digit] = segments;
+        }
+    }
+}
+
+static void SimDisplayText(char * text) {
+    for (uint8_t digit = 0; digit < SIM_DIGITS; digit++) {
+        uint8_t segments = display[digit] & ~SEGMENT_P;
+        char symbol = (segments == 0) ? '_' : '?';
+
+        // Se prefieren los digitos, y entre las letras la primera de la tabla que tiene los mismos segmentos
+        for (char candidate = '~'; (segments != 0) && (candidate > ' '); candidate--) {
+            if (ScreenGlyph(candidate) == segments) {
+                symbol = candidate;
+            }
+        }
+        *text++ = symbol;
+        if (display[digit] & SEGMENT_P) {
+            *text++ = '.';
+        }
+    }
+    *text = '\0';
+}
+
+static bool SimDisplayParse(const char * text, uint8_t segments[SIM_DIGITS]) {
+    uint8_t digit = 0;
+
+    for (; *text != '\0'; text++) {
+        if ((*text == '.') && (digit != 0) && !(segments[digit - 1] & SEGMENT_P)) {
+            segments[digit - 1] |= SEGMENT_P;
+        } else if (digit < SIM_DIGITS) {
+            segments[digit++] = (*text == '_') ? 0 : ScreenGlyph(*text);
+        } else {
+            return false;
+        }
+    }
+    return digit == SIM_DIGITS;
+}
+
+static void SimExecute(const struct sim_action_s * action) {
+    const struct sim_pin_s * pin;
+    char text[2 * SIM_DIGITS + 1];
+    uint8_t expected[SIM_DIGITS];
+    bool state;
+
+    if ((strcmp(action->command, "press") == 0) || (strcmp(action->command, "release") == 0)) {
+        pin = SimFindPin(KEYS, action->argument);
+        if (pin == NULL) {
+            fprintf(stderr, "sim: linea %u: tecla desconocida %s\n", action->line, action->argument);
+            failures++;
+        } else {
+            SimGpioSetInput(pin->gpio, pin->bit, action->command[0] == 'p');
+        }
+    } else if (strcmp(action->command, "display") == 0) {
+        checks++;
+        SimDisplayText(text);
+        if (!SimDisplayParse(action->argument, expected) || (memcmp(expected, display, sizeof(display)) != 0)) {
+            printf("FALLA linea %u, %u ms: pantalla %s, se esperaba %s\n", action->line, action->time, text,
+                   action->argument);
+            failures++;
+        }
+    } else if (strcmp(action->command, "led") == 0) {
+        checks++;
+        pin = SimFindPin(OUTPUTS, action->argument);
+        state = (pin != NULL) && (SimGpioRead(pin->gpio) & (1UL << pin->bit));
+        if ((pin == NULL) || (state != (strcmp(action->value, "on") == 0))) {
+            printf("FALLA linea %u, %u ms: salida %s %s, se esperaba %s\n", action->line, action->time,
+                   action->argument, state ? "on" : "off", action->value);
+            failures++;
+        }
+    } else if (strcmp(action->command, "pps") == 0) {
+        if (strcmp(action->argument, "off") == 0) {
+            SimReferenceStop();
+        } else {
+            SimReferenceStart((int32_t)strtol(action->argument, NULL, 10));
+        }
+    } else if (strcmp(action->command, "powerfail") == 0) {
+        SimEepromPowerFail();
+    } else if (strcmp(action->command, "dump") == 0) {
+        SimDump();
+    } else if (strcmp(action->command, "end") == 0) {
+        SimFinish();
+    } else {
+        fprintf(stderr, "sim: linea %u: accion desconocida %s\n", action->line, action->command);
+        failures++;
+    }
+}
+
+static void SimDump(void) {
+    char text[2 * SIM_DIGITS + 1];
+
+    SimDisplayText(text);
+    printf("%10.3f s  pantalla %-8s", SystemCoreClock ? (double)SimCycles() / SystemCoreClock : 0.0, text);
+    for (uint8_t index = 0; OUTPUTS[index].name != NULL; index++) {
+        bool state = SimGpioRead(OUTPUTS[index].gpio) & (1UL << OUTPUTS[index].bit);
+        printf("  %s %s", OUTPUTS[index].name, state ? "on" : "off");
+    }
+    printf("\n");
+}
+
+static void SimPrintLine(const char * line) {
+    printf("%s\n", line);
+}
+
+static void SimFinish(void) {
+    power_stats_t power;
+
+#if PROFILE_ENABLED
+    ProfileDump(SimPrintLine);
+#else
+    (void)SimPrintLine;
+#endif
+    PowerGetStats(&power);
+    printf("%" PRIu32 " interrupciones, %" PRIu32 " despertares, %.1f %% del tiempo dormido\n", power.ticks,
+           power.wakeups, power.total ? (100.0 * power.asleep) / power.total : 0.0);
+    printf("%u verificaciones, %u fallas\n", checks, failures);
+    exit(failures ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/* === Public function implementation ============================================================================== */
+
+void SimPowerLoss(void) {
+    printf("corte de alimentacion a los %.3f s\n", SystemCoreClock ? (double)SimCycles() / SystemCoreClock : 0.0);
+    SimFinish();
+}
+
+void SimTickHook(void) {
+    uint32_t now;
+
+    if (SystemCoreClock == 0) {
+        return;
+    }
+    now = (uint32_t)((SimCycles() * 1000) / SystemCoreClock);
+
+    SimSampleDisplay();
+    while ((next_action < actions_count) && (actions[next_action].time <= now)) {
+        SimExecute(&actions[next_action++]);
+    }
+    if (now >= duration) {
+        SimDump();
+        SimFinish();
+    }
+}
+
+int main(int argc, char * argv[]) {
+    int option;
+
+    for (option = 1; option < argc; option++) {
+        if ((strcmp(argv[option], "-t") == 0) && (option + 1 < argc)) {
+            duration = (uint32_t)(strtod(argv[++option], NULL) * 1000);
+        } else if (argv[option][0] != '-' || argv[option][1] == '\0') {
+            if (SimLoadScript(argv[option]) != 0) {
+                return EXIT_FAILURE;
+            }
+        } else {
+            fprintf(stderr, "uso: %s [-t segundos] [guion]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((actions_count == 0) && (duration == UINT32_MAX)) {
+        fprintf(stderr, "sim: se necesita un guion o una duracion\n");
+        return EXIT_FAILURE;
+    }
+    return app_main();
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,97 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TEST_H_
+#define TEST_H_
+
+/** @file test.h
+ ** @brief Verificaciones minimas para las pruebas unitarias de los modulos en la computadora de desarrollo.
+ **
+ ** Cada programa de prueba incluye este archivo una sola vez, llama a sus casos con TEST_RUN y termina con
+ ** TestResult, que informa la cantidad de verificaciones y de fallas con el mismo formato que los guiones de la
+ ** simulacion.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Public macros definitions =================================================================================== */
+
+//! Verifica una condicion e informa el archivo, la linea y la condicion si no se cumple
+#define TEST_CHECK(condition)                                                                                          \
+    do {                                                                                                               \
+        test_checks++;                                                                                                 \
+        if (!(condition)) {                                                                                            \
+            test_failures++;                                                                                           \
+            printf("FALLA %s:%d, %s: %s\n", __FILE__, __LINE__, test_case, #condition);                                \
+        }                                                                                                              \
+    } while (0)
+
+//! Verifica que dos valores enteros sean iguales e informa los dos valores si no lo son
+#define TEST_CHECK_EQUAL(expected, actual)                                                                             \
+    do {                                                                                                               \
+        long test_expected = (long)(expected);                                                                         \
+        long test_actual = (long)(actual);                                                                             \
+                                                                                                                       \
+        test_checks++;                                                                                                 \
+        if (test_expected != test_actual) {                                                                            \
+            test_failures++;                                                                                           \
+            printf("FALLA %s:%d, %s: %s es %ld, se esperaba %ld\n", __FILE__, __LINE__, test_case, #actual,            \
+                   test_actual, test_expected);                                                                        \
+        }                                                                                                              \
+    } while (0)
+
+//! Ejecuta un caso de prueba, una funcion sin parametros, recordando su nombre para los mensajes de falla
+#define TEST_RUN(function)                                                                                             \
+    do {                                                                                                               \
+        test_case = #function;                                                                                         \
+        function();                                                                                                    \
+    } while (0)
+
+/* === Public variable declarations ================================================================================ */
+
+//! Cantidad de verificaciones realizadas
+static unsigned test_checks;
+
+//! Cantidad de verificaciones que fallaron
+static unsigned test_failures;
+
+//! Nombre del caso de prueba en curso
+static const char * test_case = "";
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Informa el resultado de todas las verificaciones.
+ *
+ * @return int Codigo de salida del programa, EXIT_FAILURE si alguna verificacion fallo.
+ */
+static inline int TestResult(void) {
+    printf("%u verificaciones, %u fallas\n", test_checks, test_failures);
+    return (test_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#endif /* TEST_H_ */
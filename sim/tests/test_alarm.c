@@ -0,0 +1,299 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_alarm.c
+ ** @brief Pruebas unitarias del conjunto de alarmas.
+ **
+ ** El tiempo avanza llamando a AlarmsNewMinute, como lo hace la aplicacion en cada cambio de minuto, y el sonido usa
+ ** un driver que cuenta cuantas veces se enciende y se apaga.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "alarm.h"
+#include "config.h"
+#include "test.h"
+#include <stdbool.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Minutos que se pospone una alarma en las pruebas
+#define SNOOZE_MINUTES   10
+
+//! Cantidad de minutos en un dia
+#define MINUTES_PER_DAY  1440
+
+//! Cantidad de minutos en una semana
+#define MINUTES_PER_WEEK (7 * MINUTES_PER_DAY)
+
+//! Dias de la semana con el mismo numero que usa AlarmsSetTime
+enum {
+    SUNDAY,
+    MONDAY,
+    TUESDAY,
+    WEDNESDAY,
+    THURSDAY,
+    FRIDAY,
+    SATURDAY,
+};
+
+/* === Private function declarations =============================================================================== */
+
+static void DriverTurnOn(uint8_t alarm);
+static void DriverTurnOff(void);
+
+/**
+ * @brief Crea un conjunto de alarmas con el driver de prueba y reinicia sus contadores.
+ *
+ * @param weekday Dia de la semana con el que arranca el tiempo de las alarmas.
+ * @param time Hora con la que arranca el tiempo de las alarmas, en digitos BCD (HHMM).
+ * @return alarms_t Conjunto de alarmas creado.
+ */
+static alarms_t CreateAlarms(uint8_t weekday, const uint8_t time[4]);
+
+/**
+ * @brief Configura una alarma habilitada.
+ *
+ * @param alarms Conjunto de alarmas.
+ * @param index Numero de alarma.
+ * @param time Hora de la alarma en digitos BCD (HHMM).
+ * @param weekdays Mascara de dias de la semana en que suena.
+ * @param recurring true si se repite, false si suena una sola vez.
+ */
+static void SetAlarm(alarms_t alarms, uint8_t index, const uint8_t time[4], uint8_t weekdays, bool recurring);
+
+/**
+ * @brief Avanza el tiempo de las alarmas una cantidad de minutos.
+ *
+ * @param alarms Conjunto de alarmas.
+ * @param minutes Minutos a avanzar.
+ * @return uint16_t Cantidad de minutos en que empezo a sonar una alarma.
+ */
+static uint16_t Advance(alarms_t alarms, uint16_t minutes);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Driver que cuenta los encendidos y apagados en lugar de manejar el zumbador
+static const struct alarm_driver_s driver = {
+    .AlarmTurnOn = DriverTurnOn,
+    .AlarmTurnOff = DriverTurnOff,
+};
+
+//! Cantidad de veces que se encendio el sonido
+static uint16_t turned_on;
+
+//! Cantidad de veces que se apago el sonido
+static uint16_t turned_off;
+
+//! Alarma informada en el ultimo encendido
+static uint8_t last_alarm;
+
+/* === Private function definitions ================================================================================ */
+
+static void DriverTurnOn(uint8_t alarm) {
+    turned_on++;
+    last_alarm = alarm;
+}
+
+static void DriverTurnOff(void) {
+    turned_off++;
+}
+
+static alarms_t CreateAlarms(uint8_t weekday, const uint8_t time[4]) {
+    alarms_t alarms = AlarmsCreate(&driver, SNOOZE_MINUTES);
+
+    turned_on = 0;
+    turned_off = 0;
+    last_alarm = ALARM_NONE;
+    AlarmsSetTime(alarms, weekday, time);
+    return alarms;
+}
+
+static void SetAlarm(alarms_t alarms, uint8_t index, const uint8_t time[4], uint8_t weekdays, bool recurring) {
+    alarm_config_t config = {
+        .time = {time[0], time[1], time[2], time[3]},
+        .weekdays = weekdays,
+        .recurring = recurring,
+        .enabled = true,
+    };
+
+    TEST_CHECK_EQUAL(0, AlarmsSet(alarms, index, &config));
+}
+
+static uint16_t Advance(alarms_t alarms, uint16_t minutes) {
+    uint16_t rings = 0;
+
+    while (minutes-- > 0) {
+        rings += AlarmsNewMinute(alarms);
+    }
+    return rings;
+}
+
+static void RingsOnlyOnSelectedWeekdays(void) {
+    alarms_t alarms = CreateAlarms(SUNDAY, (uint8_t[]){0, 6, 5, 9});
+    uint16_t minutes = 0;
+
+    SetAlarm(alarms, 0, (uint8_t[]){0, 7, 0, 0}, ALARM_MONDAY | ALARM_WEDNESDAY, true);
+    TEST_CHECK_EQUAL(0, AlarmsNext(alarms, &minutes));
+    TEST_CHECK_EQUAL(MINUTES_PER_DAY + 1, minutes);
+
+    // El domingo no suena, el lunes si y despues recien el miercoles
+    TEST_CHECK_EQUAL(0, Advance(alarms, MINUTES_PER_DAY));
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    TEST_CHECK_EQUAL(0, AlarmsRinging(alarms));
+    TEST_CHECK_EQUAL(0, last_alarm);
+    AlarmsStop(alarms);
+    TEST_CHECK_EQUAL(1, turned_off);
+    TEST_CHECK_EQUAL(0, Advance(alarms, 2 * MINUTES_PER_DAY - 1));
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    TEST_CHECK_EQUAL(2, turned_on);
+}
+
+static void WeekWrapsAfterSaturday(void) {
+    alarms_t alarms = CreateAlarms(SATURDAY, (uint8_t[]){2, 3, 5, 9});
+    uint16_t minutes = 0;
+
+    SetAlarm(alarms, 1, (uint8_t[]){0, 0, 0, 0}, ALARM_SUNDAY, true);
+    AlarmsNext(alarms, &minutes);
+    TEST_CHECK_EQUAL(1, minutes);
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    TEST_CHECK_EQUAL(1, AlarmsRinging(alarms));
+
+    // Una alarma que suena un solo dia vuelve a sonar una semana despues
+    AlarmsStop(alarms);
+    TEST_CHECK_EQUAL(1, AlarmsNext(alarms, &minutes));
+    TEST_CHECK_EQUAL(MINUTES_PER_WEEK, minutes);
+    TEST_CHECK_EQUAL(0, Advance(alarms, MINUTES_PER_WEEK - 1));
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+}
+
+static void SnoozeCrossesMidnight(void) {
+    alarms_t alarms = CreateAlarms(MONDAY, (uint8_t[]){2, 3, 5, 4});
+    uint16_t minutes = 0;
+
+    SetAlarm(alarms, 0, (uint8_t[]){2, 3, 5, 5}, ALARM_MONDAY, true);
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    AlarmsSnooze(alarms);
+    TEST_CHECK_EQUAL(ALARM_NONE, AlarmsRinging(alarms));
+    TEST_CHECK_EQUAL(1, turned_off);
+    TEST_CHECK_EQUAL(0, AlarmsNext(alarms, &minutes));
+    TEST_CHECK_EQUAL(SNOOZE_MINUTES, minutes);
+
+    // La alarma pospuesta suena el martes a las 00:05 aunque no este configurada para ese dia
+    TEST_CHECK_EQUAL(0, Advance(alarms, SNOOZE_MINUTES - 1));
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    TEST_CHECK_EQUAL(0, AlarmsRinging(alarms));
+    AlarmsStop(alarms);
+    AlarmsNext(alarms, &minutes);
+    TEST_CHECK_EQUAL(MINUTES_PER_WEEK - SNOOZE_MINUTES, minutes);
+}
+
+static void SnoozeCrossesEndOfWeek(void) {
+    alarms_t alarms = CreateAlarms(SATURDAY, (uint8_t[]){2, 3, 5, 4});
+    uint16_t minutes = 0;
+
+    SetAlarm(alarms, 2, (uint8_t[]){2, 3, 5, 5}, ALARM_SATURDAY, true);
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    AlarmsSnooze(alarms);
+    TEST_CHECK_EQUAL(2, AlarmsNext(alarms, &minutes));
+    TEST_CHECK_EQUAL(SNOOZE_MINUTES, minutes);
+    TEST_CHECK_EQUAL(0, Advance(alarms, SNOOZE_MINUTES - 1));
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    TEST_CHECK_EQUAL(2, AlarmsRinging(alarms));
+
+    // Posponer otra vez tambien cuenta desde el minuto actual, ya en el domingo
+    AlarmsSnooze(alarms);
+    TEST_CHECK_EQUAL(1, Advance(alarms, SNOOZE_MINUTES));
+    TEST_CHECK_EQUAL(3, turned_on);
+}
+
+static void OneShotDisablesAfterRinging(void) {
+    alarms_t alarms = CreateAlarms(WEDNESDAY, (uint8_t[]){0, 6, 5, 9});
+    alarm_config_t config;
+
+    SetAlarm(alarms, 3, (uint8_t[]){0, 7, 0, 0}, ALARM_EVERY_DAY, false);
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    AlarmsGet(alarms, 3, &config);
+    TEST_CHECK_EQUAL(false, config.enabled);
+
+    // Una alarma que suena una sola vez todavia se puede posponer
+    AlarmsSnooze(alarms);
+    TEST_CHECK_EQUAL(1, Advance(alarms, SNOOZE_MINUTES));
+    AlarmsStop(alarms);
+    TEST_CHECK_EQUAL(ALARM_NONE, AlarmsNext(alarms, NULL));
+    TEST_CHECK_EQUAL(0, Advance(alarms, MINUTES_PER_WEEK));
+}
+
+static void SameMinuteAlarmsRingTogether(void) {
+    alarms_t alarms = CreateAlarms(FRIDAY, (uint8_t[]){0, 6, 5, 9});
+    alarm_config_t config;
+    uint16_t minutes = 0;
+
+    SetAlarm(alarms, 1, (uint8_t[]){0, 7, 0, 0}, ALARM_EVERY_DAY, true);
+    SetAlarm(alarms, 2, (uint8_t[]){0, 7, 0, 0}, ALARM_FRIDAY, false);
+    SetAlarm(alarms, 3, (uint8_t[]){0, 7, 0, 0}, ALARM_EVERY_DAY, true);
+
+    // Suenan juntas con un solo encendido, se informa la de menor numero
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    TEST_CHECK_EQUAL(1, turned_on);
+    TEST_CHECK_EQUAL(1, AlarmsRinging(alarms));
+    AlarmsGet(alarms, 2, &config);
+    TEST_CHECK_EQUAL(false, config.enabled);
+
+    // Ninguna queda postergada una semana por haber vencido en el mismo minuto que otra
+    TEST_CHECK_EQUAL(1, AlarmsNext(alarms, &minutes));
+    TEST_CHECK_EQUAL(MINUTES_PER_DAY, minutes);
+
+    // Posponer pospone a todas las que suenan, que vuelven a sonar juntas
+    AlarmsSnooze(alarms);
+    TEST_CHECK_EQUAL(1, Advance(alarms, SNOOZE_MINUTES));
+    TEST_CHECK_EQUAL(2, turned_on);
+    AlarmsStop(alarms);
+    TEST_CHECK_EQUAL(0, Advance(alarms, MINUTES_PER_DAY - SNOOZE_MINUTES - 1));
+    TEST_CHECK_EQUAL(1, Advance(alarms, 1));
+    TEST_CHECK_EQUAL(3, turned_on);
+    AlarmsStop(alarms);
+
+    // Una alarma pospuesta que vence en el mismo minuto que otra configurada tampoco se pierde
+    SetAlarm(alarms, 0, (uint8_t[]){0, 7, 1, 0}, ALARM_SUNDAY, true);
+    TEST_CHECK_EQUAL(1, Advance(alarms, MINUTES_PER_DAY));
+    AlarmsSnooze(alarms);
+    TEST_CHECK_EQUAL(1, Advance(alarms, SNOOZE_MINUTES));
+    TEST_CHECK_EQUAL(0, AlarmsRinging(alarms));
+    AlarmsStop(alarms);
+    TEST_CHECK_EQUAL(1, AlarmsNext(alarms, &minutes));
+    TEST_CHECK_EQUAL(MINUTES_PER_DAY - SNOOZE_MINUTES, minutes);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    TEST_RUN(RingsOnlyOnSelectedWeekdays);
+    TEST_RUN(WeekWrapsAfterSaturday);
+    TEST_RUN(SnoozeCrossesMidnight);
+    TEST_RUN(SnoozeCrossesEndOfWeek);
+    TEST_RUN(OneShotDisablesAfterRinging);
+    TEST_RUN(SameMinuteAlarmsRingTogether);
+    return TestResult();
+}
+
+/* === End of documentation ======================================================================================== */
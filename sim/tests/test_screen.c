@@ -0,0 +1,248 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_screen.c
+ ** @brief Pruebas unitarias de la escritura y el desplazamiento de textos y del brillo de la pantalla.
+ **
+ ** La pantalla usa un driver que guarda los segmentos que recibe cada digito, y el contenido se compara con textos en
+ ** el mismo formato que la accion display de los guiones: un caracter por digito, '_' para un digito apagado y un
+ ** punto despues del caracter para el punto decimal.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include "config.h"
+#include "test.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de digitos de la pantalla que se prueba, la misma que la del poncho
+#define DIGITS 4
+
+/* === Private function declarations =============================================================================== */
+
+static void DriverDigitsTurnOff(void);
+static void DriverSegmentsUpdate(uint8_t value);
+static void DriverDigitsTurnOn(uint8_t digit);
+static void DriverFrameUpdate(const uint8_t images[], uint8_t digits);
+
+/**
+ * @brief Barre todos los digitos de la pantalla y compara lo que muestran con un texto.
+ *
+ * @param screen Pantalla a barrer.
+ * @param expected Texto esperado, con el formato de la accion display de los guiones.
+ * @return bool true si la pantalla muestra el texto, sino informa lo que muestra y devuelve false.
+ */
+static bool DisplayIs(screen_t screen, const char * expected);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Driver que registra los segmentos de cada digito en lugar de manejar los puertos
+static const struct screen_driver_s driver = {
+    .DigitsTurnOff = DriverDigitsTurnOff,
+    .SegmentsUpdate = DriverSegmentsUpdate,
+    .DigitsTurnOn = DriverDigitsTurnOn,
+};
+
+//! Driver que registra el cuadro completo, como el de una pantalla que se multiplexa por hardware
+static const struct screen_driver_s frame_driver = {
+    .FrameUpdate = DriverFrameUpdate,
+};
+
+//! Segmentos escritos en el ultimo llamado a SegmentsUpdate
+static uint8_t segments;
+
+//! Segmentos que muestra cada digito en el ultimo barrido
+static uint8_t shown[DIGITS];
+
+/* === Private function definitions ================================================================================ */
+
+static void DriverDigitsTurnOff(void) {
+}
+
+static void DriverSegmentsUpdate(uint8_t value) {
+    segments = value;
+}
+
+static void DriverDigitsTurnOn(uint8_t digit) {
+    shown[digit] = segments;
+}
+
+static void DriverFrameUpdate(const uint8_t images[], uint8_t digits) {
+    memcpy(shown, images, digits);
+}
+
+static bool DisplayIs(screen_t screen, const char * expected) {
+    uint8_t images[DIGITS] = {0};
+    uint8_t digit = 0;
+
+    for (; (*expected != '\0') && (digit < DIGITS); expected++) {
+        images[digit++] = (*expected == '_') ? 0 : ScreenGlyph(*expected);
+        if (expected[1] == '.') {
+            images[digit - 1] |= SEGMENT_P;
+            expected++;
+        }
+    }
+
+    // Los digitos con brillo cero no se encienden y conservan los segmentos del barrido anterior
+    memset(shown, 0, sizeof(shown));
+    for (digit = 0; digit < DIGITS; digit++) {
+        ScreenRefresh(screen);
+    }
+    if (memcmp(images, shown, sizeof(images)) != 0) {
+        printf("pantalla %02x %02x %02x %02x\n", shown[0], shown[1], shown[2], shown[3]);
+        return false;
+    }
+    return true;
+}
+
+static void WriteStringTurnsOnPoints(void) {
+    screen_t screen = ScreenCreate(DIGITS, &driver);
+
+    TEST_CHECK_EQUAL(0, ScreenWriteString(screen, "1.2,3"));
+    TEST_CHECK(DisplayIs(screen, "1.2.3_"));
+
+    // Un punto al principio o despues de otro punto ocupa un digito propio
+    TEST_CHECK_EQUAL(0, ScreenWriteString(screen, ".1.."));
+    TEST_CHECK(DisplayIs(screen, "_.1._._"));
+}
+
+static void WriteStringShowsFirstDigits(void) {
+    screen_t screen = ScreenCreate(DIGITS, &driver);
+
+    TEST_CHECK_EQUAL(0, ScreenWriteString(screen, "HoLA.123"));
+    TEST_CHECK(DisplayIs(screen, "HoLA."));
+    TEST_CHECK_EQUAL(-1, ScreenWriteString(screen, NULL));
+    TEST_CHECK(DisplayIs(screen, "HoLA."));
+}
+
+static void ScrollShiftsOneDigitPerStep(void) {
+    screen_t screen = ScreenCreate(DIGITS, &driver);
+    static const char * const STEPS[] = {"___A", "__Ab", "_AbC", "AbC_", "bC__", "C___", "____"};
+    uint8_t steps = sizeof(STEPS) / sizeof(STEPS[0]);
+
+    // El texto entra por la derecha y despues pasan tantos digitos apagados como tiene la pantalla
+    TEST_CHECK_EQUAL(0, ScreenScrollString(screen, "AbC"));
+    TEST_CHECK(DisplayIs(screen, "____"));
+    for (uint8_t step = 0; step < steps; step++) {
+        TEST_CHECK_EQUAL(step == steps - 1, ScreenScrollStep(screen));
+        TEST_CHECK(DisplayIs(screen, STEPS[step]));
+    }
+
+    // Al terminar el texto vuelve a empezar
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK(DisplayIs(screen, "___A"));
+}
+
+static void ScrollKeepsPoints(void) {
+    screen_t screen = ScreenCreate(DIGITS, &driver);
+
+    // Los puntos no ocupan digitos, se desplazan junto con el caracter al que siguen
+    TEST_CHECK_EQUAL(0, ScreenScrollString(screen, "AL 0.1"));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK(DisplayIs(screen, "AL_0."));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK(DisplayIs(screen, "L_0.1"));
+    for (uint8_t step = 0; step < DIGITS - 1; step++) {
+        TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    }
+    TEST_CHECK(DisplayIs(screen, "1___"));
+    TEST_CHECK_EQUAL(true, ScreenScrollStep(screen));
+}
+
+static void ScrollRejectsLongText(void) {
+    screen_t screen = ScreenCreate(DIGITS, &driver);
+    char text[SCREEN_MARQUEE_SIZE + 3];
+
+    // El limite cuenta digitos, un punto final no ocupa lugar
+    memset(text, '8', SCREEN_MARQUEE_SIZE);
+    strcpy(&text[SCREEN_MARQUEE_SIZE], ".");
+    TEST_CHECK_EQUAL(0, ScreenScrollString(screen, text));
+    strcpy(&text[SCREEN_MARQUEE_SIZE], "8");
+    TEST_CHECK_EQUAL(-1, ScreenScrollString(screen, text));
+    TEST_CHECK_EQUAL(-1, ScreenScrollString(screen, ""));
+    TEST_CHECK_EQUAL(-1, ScreenScrollString(screen, NULL));
+
+    // Un texto rechazado no altera el que se esta desplazando
+    TEST_CHECK_EQUAL(0, ScreenScrollString(screen, "AbC"));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK_EQUAL(-1, ScreenScrollString(screen, text));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK(DisplayIs(screen, "_AbC"));
+}
+
+static void WriteStopsScroll(void) {
+    screen_t screen = ScreenCreate(DIGITS, &driver);
+    uint8_t value[DIGITS] = {1, 2, 3, 4};
+
+    TEST_CHECK_EQUAL(0, ScreenScrollString(screen, "AbC"));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    ScreenWriteBCD(screen, value, DIGITS);
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK(DisplayIs(screen, "1234"));
+
+    TEST_CHECK_EQUAL(0, ScreenScrollString(screen, "AbC"));
+    TEST_CHECK_EQUAL(0, ScreenWriteString(screen, "Err"));
+    TEST_CHECK_EQUAL(false, ScreenScrollStep(screen));
+    TEST_CHECK(DisplayIs(screen, "Err_"));
+}
+
+static void BrightnessZeroBlanksFrame(void) {
+    screen_t screen = ScreenCreate(DIGITS, &frame_driver);
+    uint8_t value[DIGITS] = {1, 2, 3, 4};
+
+    // El driver no recibe el brillo, una pantalla apagada le tiene que llegar con todos los digitos apagados
+    ScreenWriteBCD(screen, value, DIGITS);
+    ScreenSetPoint(screen, 2, true);
+    TEST_CHECK(DisplayIs(screen, "12.34"));
+    TEST_CHECK_EQUAL(0, ScreenSetBrightness(screen, 0));
+    TEST_CHECK(DisplayIs(screen, "____"));
+
+    // Un digito sin brillo relativo se apaga solo, y el resto se muestra igual con cualquier brillo distinto de cero
+    TEST_CHECK_EQUAL(0, ScreenSetBrightness(screen, 1));
+    TEST_CHECK_EQUAL(0, ScreenSetDigitBrightness(screen, 1, 0));
+    TEST_CHECK(DisplayIs(screen, "1_34"));
+    TEST_CHECK_EQUAL(0, ScreenSetDigitBrightness(screen, 1, SCREEN_BRIGHTNESS_MAX));
+    TEST_CHECK(DisplayIs(screen, "12.34"));
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    TEST_RUN(WriteStringTurnsOnPoints);
+    TEST_RUN(WriteStringShowsFirstDigits);
+    TEST_RUN(ScrollShiftsOneDigitPerStep);
+    TEST_RUN(ScrollKeepsPoints);
+    TEST_RUN(ScrollRejectsLongText);
+    TEST_RUN(WriteStopsScroll);
+    TEST_RUN(BrightnessZeroBlanksFrame);
+    return TestResult();
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,591 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_ui.c
+ ** @brief Pruebas unitarias de la tabla de transiciones de la interfaz de usuario.
+ **
+ ** La interfaz se prueba con el reloj, las alarmas, la pantalla y el planificador reales, sin ticks ni teclas. Cada
+ ** caso de la prueba exhaustiva lleva una interfaz nueva a un estado, le envia un evento y verifica el estado
+ ** siguiente y el efecto de la accion sobre el reloj y las alarmas. Los cambios en la hora o la alarma que se esta
+ ** configurando no se ven hasta guardarlos, por eso cuando el estado siguiente es de configuracion se acepta hasta
+ ** volver a mostrar la hora y se verifica lo que se guardo. Las celdas que no aparecen en la tabla de la interfaz
+ ** tienen que dejar todo como estaba.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "ui.h"
+#include "config.h"
+#include "test.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de digitos de la pantalla que se prueba, la misma que la del poncho
+#define DIGITS         4
+
+//! Minutos que se pospone una alarma en las pruebas
+#define SNOOZE_MINUTES 5
+
+//! Dia de la semana con el que arranca el reloj, martes
+#define START_WEEKDAY  2
+
+/* === Private data type declarations ============================================================================== */
+
+//! Efecto esperado de la accion de una celda de la tabla
+typedef enum effect_e {
+    EFFECT_NONE,         //!< No cambia nada, la celda se ignora o solo cambia el estado
+    EFFECT_MINUTES_UP,   //!< Incrementa los minutos que se configuran
+    EFFECT_MINUTES_DOWN, //!< Decrementa los minutos que se configuran
+    EFFECT_HOURS_UP,     //!< Incrementa las horas que se configuran
+    EFFECT_HOURS_DOWN,   //!< Decrementa las horas que se configuran
+    EFFECT_WEEKDAY_UP,   //!< Incrementa el dia de la semana que se configura
+    EFFECT_WEEKDAY_DOWN, //!< Decrementa el dia de la semana que se configura
+    EFFECT_COMMIT_TIME,  //!< Guarda la hora con los segundos en cero
+    EFFECT_COMMIT_ALARM, //!< Guarda la alarma y la habilita
+    EFFECT_ENABLE,       //!< Habilita la alarma
+    EFFECT_DISABLE,      //!< Deshabilita la alarma
+    EFFECT_SNOOZE,       //!< Pospone la alarma que suena
+    EFFECT_STOP,         //!< Apaga la alarma que suena
+    EFFECT_SHOW,         //!< Muestra la hora actual
+} effect_t;
+
+//! Resultado esperado de enviar un evento en un estado
+struct expected_s {
+    ui_state_t next; //!< Estado siguiente, UI_STATE_NONE si no cambia
+    effect_t effect; //!< Efecto de la accion
+};
+
+//! Objetos que forman la interfaz que se prueba
+struct fixture_s {
+    clock_bcd_t clock;
+    alarms_t alarms;
+    screen_t screen;
+    scheduler_t scheduler;
+    ui_t ui;
+};
+
+//! Estado observable del reloj y las alarmas
+struct snapshot_s {
+    clock_time_t time;
+    uint8_t weekday;
+    alarm_config_t alarm;
+    uint8_t ringing;
+    uint8_t next;
+    uint16_t minutes;
+    uint16_t turned_off;
+};
+
+//! Hora y dia de la semana, para lo que se configura y se guarda
+struct values_s {
+    int8_t hours;
+    int8_t minutes;
+    int8_t weekday;
+};
+
+/* === Private function declarations =============================================================================== */
+
+static void DriverDigitsTurnOff(void);
+static void DriverSegmentsUpdate(uint8_t value);
+static void DriverDigitsTurnOn(uint8_t digit);
+static void DriverTurnOn(uint8_t alarm);
+static void DriverTurnOff(void);
+
+/**
+ * @brief Crea una interfaz nueva con el reloj el martes a las 10:20:30 y la alarma 0 a las 10:21, deshabilitada.
+ *
+ * @param fixture Donde se guardan los objetos creados.
+ */
+static void FixtureCreate(struct fixture_s * fixture);
+
+/**
+ * @brief Lleva la interfaz a un estado con la misma secuencia de eventos que usaria una persona.
+ *
+ * @param fixture Interfaz recien creada.
+ * @param state Estado al que se la lleva.
+ */
+static void FixtureEnter(struct fixture_s * fixture, ui_state_t state);
+
+/**
+ * @brief Copia el estado observable del reloj y las alarmas.
+ *
+ * @param fixture Interfaz que se prueba.
+ * @param snapshot Donde se copia el estado.
+ */
+static void TakeSnapshot(struct fixture_s * fixture, struct snapshot_s * snapshot);
+
+/**
+ * @brief Compara dos copias del estado observable del reloj y las alarmas.
+ *
+ * @param expected Estado esperado.
+ * @param actual Estado obtenido.
+ * @return bool true si son iguales, sino informa las diferencias y devuelve false.
+ */
+static bool SnapshotIs(const struct snapshot_s * expected, const struct snapshot_s * actual);
+
+/**
+ * @brief Acepta hasta volver a mostrar la hora y verifica la hora o la alarma que se guardo.
+ *
+ * @param fixture Interfaz en un estado de configuracion.
+ * @param expected Valores que se tienen que haber guardado.
+ * @return bool true si se guardaron los valores esperados.
+ */
+static bool CommitIs(struct fixture_s * fixture, const struct values_s * expected);
+
+/**
+ * @brief Barre todos los digitos de la pantalla y compara lo que muestran con un texto de cuatro digitos.
+ *
+ * @param screen Pantalla a barrer.
+ * @param expected Texto esperado, '_' para un digito apagado.
+ * @return bool true si la pantalla muestra el texto.
+ */
+static bool DisplayIs(screen_t screen, const char * expected);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Driver que registra los segmentos de cada digito en lugar de manejar los puertos
+static const struct screen_driver_s screen_driver = {
+    .DigitsTurnOff = DriverDigitsTurnOff,
+    .SegmentsUpdate = DriverSegmentsUpdate,
+    .DigitsTurnOn = DriverDigitsTurnOn,
+};
+
+//! Driver que cuenta los encendidos y apagados en lugar de manejar el zumbador
+static const struct alarm_driver_s alarm_driver = {
+    .AlarmTurnOn = DriverTurnOn,
+    .AlarmTurnOff = DriverTurnOff,
+};
+
+//! Resultado esperado de cada celda, las que no aparecen se tienen que ignorar
+static const struct expected_s EXPECTED[UI_STATES_COUNT][UI_EVENTS_COUNT] = {
+    [UI_SHOW_TIME] = {
+        [UI_EVENT_SET_TIME] = {UI_SET_TIME_MINUTES, EFFECT_NONE},
+        [UI_EVENT_SET_ALARM] = {UI_SET_ALARM_MINUTES, EFFECT_NONE},
+        [UI_EVENT_ACCEPT] = {UI_STATE_NONE, EFFECT_ENABLE},
+        [UI_EVENT_CANCEL] = {UI_STATE_NONE, EFFECT_DISABLE},
+        [UI_EVENT_SECOND] = {UI_STATE_NONE, EFFECT_SHOW},
+        [UI_EVENT_ALARM] = {UI_RINGING, EFFECT_NONE},
+    },
+    [UI_SET_TIME_MINUTES] = {
+        [UI_EVENT_INCREMENT] = {UI_STATE_NONE, EFFECT_MINUTES_UP},
+        [UI_EVENT_DECREMENT] = {UI_STATE_NONE, EFFECT_MINUTES_DOWN},
+        [UI_EVENT_ACCEPT] = {UI_SET_TIME_HOURS, EFFECT_NONE},
+        [UI_EVENT_CANCEL] = {UI_SHOW_TIME, EFFECT_NONE},
+        [UI_EVENT_ALARM] = {UI_RINGING, EFFECT_NONE},
+        [UI_EVENT_TIMEOUT] = {UI_SHOW_TIME, EFFECT_NONE},
+    },
+    [UI_SET_TIME_HOURS] = {
+        [UI_EVENT_INCREMENT] = {UI_STATE_NONE, EFFECT_HOURS_UP},
+        [UI_EVENT_DECREMENT] = {UI_STATE_NONE, EFFECT_HOURS_DOWN},
+        [UI_EVENT_ACCEPT] = {UI_SET_TIME_WEEKDAY, EFFECT_NONE},
+        [UI_EVENT_CANCEL] = {UI_SHOW_TIME, EFFECT_NONE},
+        [UI_EVENT_ALARM] = {UI_RINGING, EFFECT_NONE},
+        [UI_EVENT_TIMEOUT] = {UI_SHOW_TIME, EFFECT_NONE},
+    },
+    [UI_SET_TIME_WEEKDAY] = {
+        [UI_EVENT_INCREMENT] = {UI_STATE_NONE, EFFECT_WEEKDAY_UP},
+        [UI_EVENT_DECREMENT] = {UI_STATE_NONE, EFFECT_WEEKDAY_DOWN},
+        [UI_EVENT_ACCEPT] = {UI_SHOW_TIME, EFFECT_COMMIT_TIME},
+        [UI_EVENT_CANCEL] = {UI_SHOW_TIME, EFFECT_NONE},
+        [UI_EVENT_ALARM] = {UI_RINGING, EFFECT_NONE},
+        [UI_EVENT_TIMEOUT] = {UI_SHOW_TIME, EFFECT_NONE},
+    },
+    [UI_SET_ALARM_MINUTES] = {
+        [UI_EVENT_INCREMENT] = {UI_STATE_NONE, EFFECT_MINUTES_UP},
+        [UI_EVENT_DECREMENT] = {UI_STATE_NONE, EFFECT_MINUTES_DOWN},
+        [UI_EVENT_ACCEPT] = {UI_SET_ALARM_HOURS, EFFECT_NONE},
+        [UI_EVENT_CANCEL] = {UI_SHOW_TIME, EFFECT_NONE},
+        [UI_EVENT_ALARM] = {UI_RINGING, EFFECT_NONE},
+        [UI_EVENT_TIMEOUT] = {UI_SHOW_TIME, EFFECT_NONE},
+    },
+    [UI_SET_ALARM_HOURS] = {
+        [UI_EVENT_INCREMENT] = {UI_STATE_NONE, EFFECT_HOURS_UP},
+        [UI_EVENT_DECREMENT] = {UI_STATE_NONE, EFFECT_HOURS_DOWN},
+        [UI_EVENT_ACCEPT] = {UI_SHOW_TIME, EFFECT_COMMIT_ALARM},
+        [UI_EVENT_CANCEL] = {UI_SHOW_TIME, EFFECT_NONE},
+        [UI_EVENT_ALARM] = {UI_RINGING, EFFECT_NONE},
+        [UI_EVENT_TIMEOUT] = {UI_SHOW_TIME, EFFECT_NONE},
+    },
+    [UI_RINGING] = {
+        [UI_EVENT_SET_ALARM] = {UI_SHOW_TIME, EFFECT_SNOOZE},
+        [UI_EVENT_ACCEPT] = {UI_SHOW_TIME, EFFECT_SNOOZE},
+        [UI_EVENT_CANCEL] = {UI_SHOW_TIME, EFFECT_STOP},
+        [UI_EVENT_TIMEOUT] = {UI_SHOW_TIME, EFFECT_STOP},
+    },
+};
+
+//! Nombres de los estados para los mensajes de falla
+static const char * const STATE_NAMES[UI_STATES_COUNT] = {
+    "NONE", "SHOW_TIME", "SET_TIME_MINUTES", "SET_TIME_HOURS", "SET_TIME_WEEKDAY", "SET_ALARM_MINUTES",
+    "SET_ALARM_HOURS", "RINGING",
+};
+
+//! Nombres de los eventos para los mensajes de falla
+static const char * const EVENT_NAMES[UI_EVENTS_COUNT] = {
+    "SET_TIME", "SET_ALARM", "INCREMENT", "DECREMENT", "ACCEPT", "CANCEL", "SECOND", "ALARM", "TIMEOUT",
+};
+
+//! Segmentos escritos en el ultimo llamado a SegmentsUpdate
+static uint8_t segments;
+
+//! Segmentos que muestra cada digito en el ultimo barrido
+static uint8_t shown[DIGITS];
+
+//! Cantidad de veces que se apago el sonido de las alarmas
+static uint16_t turned_off;
+
+/* === Private function definitions ================================================================================ */
+
+static void DriverDigitsTurnOff(void) {
+}
+
+static void DriverSegmentsUpdate(uint8_t value) {
+    segments = value;
+}
+
+static void DriverDigitsTurnOn(uint8_t digit) {
+    shown[digit] = segments;
+}
+
+static void DriverTurnOn(uint8_t alarm) {
+    (void)alarm;
+}
+
+static void DriverTurnOff(void) {
+    turned_off++;
+}
+
+static void FixtureCreate(struct fixture_s * fixture) {
+    clock_time_t time = {.bcd = {1, 0, 2, 0, 3, 0}};
+    alarm_config_t alarm = {
+        .time = {1, 0, 2, 1},
+        .weekdays = ALARM_EVERY_DAY,
+        .recurring = true,
+        .enabled = false,
+    };
+
+    turned_off = 0;
+    fixture->clock = ClockCreate(1000, NULL);
+    ClockSetTime(fixture->clock, &time);
+    ClockSetWeekday(fixture->clock, START_WEEKDAY);
+    fixture->alarms = AlarmsCreate(&alarm_driver, SNOOZE_MINUTES);
+    AlarmsSetTime(fixture->alarms, START_WEEKDAY, time.bcd);
+    AlarmsSet(fixture->alarms, 0, &alarm);
+    fixture->screen = ScreenCreate(DIGITS, &screen_driver);
+    fixture->scheduler = SchedulerCreate(1000);
+    fixture->ui = UiCreate(fixture->clock, fixture->alarms, fixture->screen, fixture->scheduler);
+}
+
+static void FixtureEnter(struct fixture_s * fixture, ui_state_t state) {
+    switch (state) {
+    case UI_SET_TIME_WEEKDAY:
+    case UI_SET_TIME_HOURS:
+    case UI_SET_TIME_MINUTES:
+        UiHandleEvent(fixture->ui, UI_EVENT_SET_TIME);
+        for (ui_state_t step = UI_SET_TIME_MINUTES; step < state; step++) {
+            UiHandleEvent(fixture->ui, UI_EVENT_ACCEPT);
+        }
+        break;
+    case UI_SET_ALARM_HOURS:
+    case UI_SET_ALARM_MINUTES:
+        UiHandleEvent(fixture->ui, UI_EVENT_SET_ALARM);
+        if (state == UI_SET_ALARM_HOURS) {
+            UiHandleEvent(fixture->ui, UI_EVENT_ACCEPT);
+        }
+        break;
+    case UI_RINGING:
+        // La alarma suena de verdad en el minuto siguiente, asi posponerla o apagarla tiene efecto
+        AlarmsEnable(fixture->alarms, 0, true);
+        AlarmsNewMinute(fixture->alarms);
+        UiHandleEvent(fixture->ui, UI_EVENT_ALARM);
+        break;
+    default:
+        break;
+    }
+}
+
+static void TakeSnapshot(struct fixture_s * fixture, struct snapshot_s * snapshot) {
+    memset(snapshot, 0, sizeof(*snapshot));
+    ClockGetTime(fixture->clock, &snapshot->time);
+    snapshot->weekday = ClockGetWeekday(fixture->clock);
+    AlarmsGet(fixture->alarms, 0, &snapshot->alarm);
+    snapshot->ringing = AlarmsRinging(fixture->alarms);
+    snapshot->next = AlarmsNext(fixture->alarms, &snapshot->minutes);
+    snapshot->turned_off = turned_off;
+}
+
+static bool SnapshotIs(const struct snapshot_s * expected, const struct snapshot_s * actual) {
+    bool result = true;
+
+    if (memcmp(&expected->time, &actual->time, sizeof(clock_time_t)) || (expected->weekday != actual->weekday)) {
+        printf("hora %u%u:%u%u:%u%u dia %u\n", actual->time.bcd[0], actual->time.bcd[1], actual->time.bcd[2],
+               actual->time.bcd[3], actual->time.bcd[4], actual->time.bcd[5], actual->weekday);
+        result = false;
+    }
+    if (memcmp(expected->alarm.time, actual->alarm.time, sizeof(actual->alarm.time)) ||
+        (expected->alarm.enabled != actual->alarm.enabled)) {
+        printf("alarma %u%u:%u%u habilitada %u\n", actual->alarm.time[0], actual->alarm.time[1], actual->alarm.time[2],
+               actual->alarm.time[3], actual->alarm.enabled);
+        result = false;
+    }
+    if ((expected->ringing != actual->ringing) || (expected->next != actual->next) ||
+        ((actual->next != ALARM_NONE) && (expected->minutes != actual->minutes)) ||
+        (expected->turned_off != actual->turned_off)) {
+        printf("sonando %u proxima %u en %u minutos apagadas %u\n", actual->ringing, actual->next, actual->minutes,
+               actual->turned_off);
+        result = false;
+    }
+    return result;
+}
+
+static bool CommitIs(struct fixture_s * fixture, const struct values_s * expected) {
+    ui_state_t state = UiGetState(fixture->ui);
+    bool alarm = (state == UI_SET_ALARM_MINUTES) || (state == UI_SET_ALARM_HOURS);
+    alarm_config_t config;
+    clock_time_t time;
+    uint8_t actual[3];
+
+    for (uint8_t step = 0; (step < 3) && (UiGetState(fixture->ui) != UI_SHOW_TIME); step++) {
+        UiHandleEvent(fixture->ui, UI_EVENT_ACCEPT);
+    }
+    if (UiGetState(fixture->ui) != UI_SHOW_TIME) {
+        printf("aceptar no guarda desde %s\n", STATE_NAMES[state]);
+        return false;
+    }
+
+    if (alarm) {
+        AlarmsGet(fixture->alarms, 0, &config);
+        actual[0] = config.time[0] * 10 + config.time[1];
+        actual[1] = config.time[2] * 10 + config.time[3];
+        actual[2] = expected->weekday;
+    } else {
+        ClockGetTime(fixture->clock, &time);
+        actual[0] = time.time.hours[0] * 10 + time.time.hours[1];
+        actual[1] = time.time.minutes[0] * 10 + time.time.minutes[1];
+        actual[2] = ClockGetWeekday(fixture->clock);
+    }
+    if ((actual[0] != expected->hours) || (actual[1] != expected->minutes) || (actual[2] != expected->weekday)) {
+        printf("se guardo %02u:%02u dia %u\n", actual[0], actual[1], actual[2]);
+        return false;
+    }
+    return true;
+}
+
+static bool DisplayIs(screen_t screen, const char * expected) {
+    uint8_t images[DIGITS];
+
+    for (uint8_t digit = 0; digit < DIGITS; digit++) {
+        images[digit] = (expected[digit] == '_') ? 0 : ScreenGlyph(expected[digit]);
+    }
+    memset(shown, 0, sizeof(shown));
+    for (uint8_t digit = 0; digit < DIGITS; digit++) {
+        ScreenRefresh(screen);
+    }
+    if (memcmp(images, shown, sizeof(images)) != 0) {
+        printf("pantalla %02x %02x %02x %02x\n", shown[0], shown[1], shown[2], shown[3]);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Verifica una celda de la tabla de transiciones.
+ *
+ * @param state Estado en el que se envia el evento.
+ * @param event Evento que se envia.
+ */
+static void CheckCell(ui_state_t state, ui_event_t event) {
+    const struct expected_s * cell = &EXPECTED[state][event];
+    ui_state_t next = (cell->next != UI_STATE_NONE) ? cell->next : state;
+    struct values_s values = {10, 20, START_WEEKDAY};
+    struct snapshot_s before;
+    struct snapshot_s after;
+    struct fixture_s fixture;
+    bool alarm;
+
+    FixtureCreate(&fixture);
+    FixtureEnter(&fixture, state);
+    if (cell->effect == EFFECT_DISABLE) {
+        AlarmsEnable(fixture.alarms, 0, true);
+    } else if (cell->effect == EFFECT_SHOW) {
+        ScreenWriteString(fixture.screen, "8888");
+    }
+    TakeSnapshot(&fixture, &before);
+
+    UiHandleEvent(fixture.ui, event);
+    TakeSnapshot(&fixture, &after);
+    test_checks++;
+    if (UiGetState(fixture.ui) != next) {
+        test_failures++;
+        printf("FALLA %s con %s: estado %s, se esperaba %s\n", STATE_NAMES[state], EVENT_NAMES[event],
+               STATE_NAMES[UiGetState(fixture.ui)], STATE_NAMES[next]);
+        return;
+    }
+
+    // Los cambios inmediatos de cada accion sobre el reloj y las alarmas
+    switch (cell->effect) {
+    case EFFECT_COMMIT_TIME:
+        before.time.time.seconds[0] = 0;
+        before.time.time.seconds[1] = 0;
+        break;
+    case EFFECT_COMMIT_ALARM:
+    case EFFECT_ENABLE:
+        before.alarm.enabled = true;
+        before.next = 0;
+        before.minutes = 1;
+        break;
+    case EFFECT_DISABLE:
+        before.alarm.enabled = false;
+        before.next = ALARM_NONE;
+        break;
+    case EFFECT_SNOOZE:
+        before.ringing = ALARM_NONE;
+        before.minutes = SNOOZE_MINUTES;
+        before.turned_off++;
+        break;
+    case EFFECT_STOP:
+        before.ringing = ALARM_NONE;
+        before.turned_off++;
+        break;
+    default:
+        break;
+    }
+    test_checks++;
+    if (!SnapshotIs(&before, &after)) {
+        test_failures++;
+        printf("FALLA %s con %s: el reloj o las alarmas no quedaron como se esperaba\n", STATE_NAMES[state],
+               EVENT_NAMES[event]);
+    }
+
+    if (cell->effect == EFFECT_SHOW) {
+        test_checks++;
+        if (!DisplayIs(fixture.screen, "1020")) {
+            test_failures++;
+            printf("FALLA %s con %s: no se muestra la hora\n", STATE_NAMES[state], EVENT_NAMES[event]);
+        }
+    }
+
+    // Lo que se esta configurando solo se ve al guardarlo, partiendo de lo que se cargo al entrar a configurar
+    if ((next >= UI_SET_TIME_MINUTES) && (next <= UI_SET_ALARM_HOURS)) {
+        alarm = (next >= UI_SET_ALARM_MINUTES);
+        values.minutes += alarm ? 1 : 0;
+        values.minutes += (cell->effect == EFFECT_MINUTES_UP) - (cell->effect == EFFECT_MINUTES_DOWN);
+        values.hours += (cell->effect == EFFECT_HOURS_UP) - (cell->effect == EFFECT_HOURS_DOWN);
+        values.weekday += (cell->effect == EFFECT_WEEKDAY_UP) - (cell->effect == EFFECT_WEEKDAY_DOWN);
+        test_checks++;
+        if (!CommitIs(&fixture, &values)) {
+            test_failures++;
+            printf("FALLA %s con %s: no se guardo lo esperado\n", STATE_NAMES[state], EVENT_NAMES[event]);
+        }
+    }
+}
+
+static void EveryEventFromEveryState(void) {
+    for (ui_state_t state = UI_SHOW_TIME; state < UI_STATES_COUNT; state++) {
+        for (ui_event_t event = 0; event < UI_EVENTS_COUNT; event++) {
+            CheckCell(state, event);
+        }
+    }
+}
+
+static void EventsOutOfRangeAreIgnored(void) {
+    struct fixture_s fixture;
+    struct snapshot_s before;
+    struct snapshot_s after;
+
+    FixtureCreate(&fixture);
+    FixtureEnter(&fixture, UI_SET_TIME_HOURS);
+    TakeSnapshot(&fixture, &before);
+    UiHandleEvent(fixture.ui, UI_EVENTS_COUNT);
+    UiHandleEvent(fixture.ui, (ui_event_t)0xFF);
+    TakeSnapshot(&fixture, &after);
+    TEST_CHECK_EQUAL(UI_SET_TIME_HOURS, UiGetState(fixture.ui));
+    TEST_CHECK(SnapshotIs(&before, &after));
+}
+
+static void EditedValuesWrapAround(void) {
+    struct fixture_s fixture;
+    clock_time_t time = {.bcd = {2, 3, 5, 9, 0, 0}};
+
+    // Los minutos, las horas y el dia dan la vuelta cada uno por su lado, sin acarreo entre ellos
+    FixtureCreate(&fixture);
+    ClockSetTime(fixture.clock, &time);
+    ClockSetWeekday(fixture.clock, 6);
+    UiHandleEvent(fixture.ui, UI_EVENT_SET_TIME);
+    UiHandleEvent(fixture.ui, UI_EVENT_INCREMENT);
+    UiHandleEvent(fixture.ui, UI_EVENT_ACCEPT);
+    UiHandleEvent(fixture.ui, UI_EVENT_INCREMENT);
+    UiHandleEvent(fixture.ui, UI_EVENT_ACCEPT);
+    UiHandleEvent(fixture.ui, UI_EVENT_INCREMENT);
+    TEST_CHECK(CommitIs(&fixture, &(struct values_s){0, 0, 0}));
+
+    UiHandleEvent(fixture.ui, UI_EVENT_SET_TIME);
+    UiHandleEvent(fixture.ui, UI_EVENT_DECREMENT);
+    UiHandleEvent(fixture.ui, UI_EVENT_ACCEPT);
+    UiHandleEvent(fixture.ui, UI_EVENT_DECREMENT);
+    UiHandleEvent(fixture.ui, UI_EVENT_ACCEPT);
+    UiHandleEvent(fixture.ui, UI_EVENT_DECREMENT);
+    TEST_CHECK(CommitIs(&fixture, &(struct values_s){23, 59, 6}));
+}
+
+static void IdleSecondsRaiseTimeout(void) {
+    struct fixture_s fixture;
+
+    // Sin teclas durante UI_TIMEOUT_SECONDS se abandona la configuracion, una tecla reinicia la cuenta
+    FixtureCreate(&fixture);
+    FixtureEnter(&fixture, UI_SET_ALARM_MINUTES);
+    for (uint16_t second = 1; second < UI_TIMEOUT_SECONDS; second++) {
+        UiHandleEvent(fixture.ui, UI_EVENT_SECOND);
+    }
+    UiHandleEvent(fixture.ui, UI_EVENT_INCREMENT);
+    for (uint16_t second = 1; second < UI_TIMEOUT_SECONDS; second++) {
+        UiHandleEvent(fixture.ui, UI_EVENT_SECOND);
+    }
+    TEST_CHECK_EQUAL(UI_SET_ALARM_MINUTES, UiGetState(fixture.ui));
+    UiHandleEvent(fixture.ui, UI_EVENT_SECOND);
+    TEST_CHECK_EQUAL(UI_SHOW_TIME, UiGetState(fixture.ui));
+
+    // La alarma que nadie atiende deja de sonar a los UI_RING_TIMEOUT_SECONDS
+    FixtureCreate(&fixture);
+    FixtureEnter(&fixture, UI_RINGING);
+    for (uint16_t second = 1; second < UI_RING_TIMEOUT_SECONDS; second++) {
+        UiHandleEvent(fixture.ui, UI_EVENT_SECOND);
+    }
+    TEST_CHECK_EQUAL(UI_RINGING, UiGetState(fixture.ui));
+    TEST_CHECK_EQUAL(0, AlarmsRinging(fixture.alarms));
+    UiHandleEvent(fixture.ui, UI_EVENT_SECOND);
+    TEST_CHECK_EQUAL(UI_SHOW_TIME, UiGetState(fixture.ui));
+    TEST_CHECK_EQUAL(ALARM_NONE, AlarmsRinging(fixture.alarms));
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    TEST_RUN(EveryEventFromEveryState);
+    TEST_RUN(EventsOutOfRangeAreIgnored);
+    TEST_RUN(EditedValuesWrapAround);
+    TEST_RUN(IdleSecondsRaiseTimeout);
+    return TestResult();
+}
+
+/* === End of documentation ======================================================================================== */
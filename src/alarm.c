@@ -0,0 +1,322 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file alarm.c
+ ** @brief Codigo fuente del módulo de alarmas multiples del reloj.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "alarm.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de minutos en un dia
+#define MINUTES_PER_DAY  1440
+//! Cantidad de minutos en una semana, el tiempo de las alarmas se cuenta modulo este valor
+#define MINUTES_PER_WEEK (7 * MINUTES_PER_DAY)
+//! Marca de tiempo que indica que no hay ningun evento pendiente
+#define NO_DUE           0xFFFF
+
+/* === Private data type declarations ============================================================================== */
+
+struct alarm_s {
+    alarm_config_t config; // configuracion de la alarma
+    uint16_t minute;       // minuto del dia en que suena la alarma, calculado al configurarla
+    uint16_t snoozed;      // minuto de la semana en que vuelve a sonar si fue pospuesta
+    bool ringing;          // true si la alarma esta sonando, junto con las que vencieron en el mismo minuto
+};
+
+struct alarms_s {
+    struct alarm_s alarms[ALARM_MAX_COUNT]; // alarmas configuradas
+    alarm_driver_t driver;                  // puntero a la estructura de driver del sonido
+    uint16_t now;                           // minuto actual de la semana
+    uint16_t next_due;                      // minuto de la semana en que suena la proxima alarma
+    uint8_t next;                           // numero de la proxima alarma a sonar
+    uint8_t ringing;                        // numero de la alarma que esta sonando
+    uint8_t snooze_minutes;                 // minutos que se pospone una alarma
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte una hora en digitos BCD (HHMM) al minuto del dia.
+ *
+ * @param time Hora en digitos BCD.
+ * @return uint16_t Minuto del dia o NO_DUE si la hora no es valida.
+ */
+static uint16_t MinuteOfDay(const uint8_t time[4]);
+
+/**
+ * @brief Calcula cuantos minutos faltan desde el tiempo actual hasta un minuto de la semana.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @param due Minuto de la semana.
+ * @return uint16_t Minutos hasta el evento, entre 1 y MINUTES_PER_WEEK, un evento en el minuto actual se considera
+ * dentro de una semana.
+ */
+static uint16_t MinutesUntil(struct alarms_s * self, uint16_t due);
+
+/**
+ * @brief Recorre todas las alarmas y precalcula la proxima que va a sonar.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ */
+static void AlarmsScheduleNext(struct alarms_s * self);
+
+/**
+ * @brief Indica si una alarma vence en el minuto actual, por su configuracion o porque fue pospuesta.
+ *
+ * @param self Puntero al conjunto de alarmas.
+ * @param alarm Alarma a controlar.
+ * @param weekday Dia de la semana del minuto actual.
+ * @param minute Minuto del dia del minuto actual.
+ * @return bool true si la alarma tiene que sonar en el minuto actual.
+ */
+static bool AlarmIsDue(struct alarms_s * self, struct alarm_s * alarm, uint8_t weekday, uint16_t minute);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toman los conjuntos de alarmas
+POOL_DEFINE(AlarmsAllocate, struct alarms_s, ALARMS_INSTANCES)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t MinuteOfDay(const uint8_t time[4]) {
+    uint16_t result = NO_DUE;
+    uint8_t hours = time[0] * 10 + time[1];
+    uint8_t minutes = time[2] * 10 + time[3];
+
+    if ((time[0] < 3) && (time[1] < 10) && (time[2] < 6) && (time[3] < 10) && (hours < 24) && (minutes < 60)) {
+        result = hours * 60 + minutes;
+    }
+    return result;
+}
+
+static uint16_t MinutesUntil(struct alarms_s * self, uint16_t due) {
+    uint16_t result;
+
+    if (due > self->now) {
+        result = due - self->now;
+    } else {
+        result = MINUTES_PER_WEEK - (self->now - due);
+    }
+    return result;
+}
+
+static void AlarmsScheduleNext(struct alarms_s * self) {
+    uint16_t best = NO_DUE;
+    uint16_t distance;
+
+    self->next = ALARM_NONE;
+    self->next_due = NO_DUE;
+
+    for (uint8_t index = 0; index < ALARM_MAX_COUNT; index++) {
+        struct alarm_s * alarm = &self->alarms[index];
+
+        if (alarm->snoozed != NO_DUE) {
+            distance = MinutesUntil(self, alarm->snoozed);
+            if (distance < best) {
+                best = distance;
+                self->next = index;
+            }
+        }
+        if (!alarm->config.enabled) {
+            continue;
+        }
+        for (uint8_t day = 0; day < 7; day++) {
+            if (alarm->config.weekdays & (1 << day)) {
+                distance = MinutesUntil(self, day * MINUTES_PER_DAY + alarm->minute);
+                if (distance < best) {
+                    best = distance;
+                    self->next = index;
+                }
+            }
+        }
+    }
+
+    if (self->next != ALARM_NONE) {
+        self->next_due = self->now + best;
+        if (self->next_due >= MINUTES_PER_WEEK) {
+            self->next_due -= MINUTES_PER_WEEK;
+        }
+    }
+}
+
+static bool AlarmIsDue(struct alarms_s * self, struct alarm_s * alarm, uint8_t weekday, uint16_t minute) {
+    if (alarm->snoozed == self->now) {
+        return true;
+    }
+    return alarm->config.enabled && (alarm->config.weekdays & (1 << weekday)) && (alarm->minute == minute);
+}
+
+/* === Public function implementation ============================================================================== */
+
+alarms_t AlarmsCreate(alarm_driver_t driver, uint8_t snooze_minutes) {
+    alarms_t self = AlarmsAllocate();
+
+    if (self != NULL) {
+        for (uint8_t index = 0; index < ALARM_MAX_COUNT; index++) {
+            self->alarms[index].snoozed = NO_DUE;
+        }
+        self->driver = driver;
+        self->snooze_minutes = snooze_minutes;
+        self->ringing = ALARM_NONE;
+        AlarmsScheduleNext(self);
+    }
+    return self;
+}
+
+int AlarmsSet(alarms_t self, uint8_t index, const alarm_config_t * config) {
+    int result = 0;
+    uint16_t minute = MinuteOfDay(config->time);
+
+    if ((index >= ALARM_MAX_COUNT) || (minute == NO_DUE)) {
+        result = -1;
+    } else {
+        self->alarms[index].config = *config;
+        self->alarms[index].minute = minute;
+        self->alarms[index].snoozed = NO_DUE;
+        AlarmsScheduleNext(self);
+    }
+    return result;
+}
+
+int AlarmsGet(alarms_t self, uint8_t index, alarm_config_t * config) {
+    int result = 0;
+
+    if (index >= ALARM_MAX_COUNT) {
+        result = -1;
+    } else {
+        *config = self->alarms[index].config;
+    }
+    return result;
+}
+
+int AlarmsEnable(alarms_t self, uint8_t index, bool enabled) {
+    int result = 0;
+
+    if (index >= ALARM_MAX_COUNT) {
+        result = -1;
+    } else {
+        self->alarms[index].config.enabled = enabled;
+        self->alarms[index].snoozed = NO_DUE;
+        AlarmsScheduleNext(self);
+    }
+    return result;
+}
+
+void AlarmsSetTime(alarms_t self, uint8_t weekday, const uint8_t time[4]) {
+    uint16_t minute = MinuteOfDay(time);
+
+    if ((weekday < 7) && (minute != NO_DUE)) {
+        self->now = weekday * MINUTES_PER_DAY + minute;
+        AlarmsScheduleNext(self);
+    }
+}
+
+bool AlarmsNewMinute(alarms_t self) {
+    bool result = false;
+
+    self->now++;
+    if (self->now == MINUTES_PER_WEEK) {
+        self->now = 0;
+    }
+
+    // Solo en el minuto de la proxima alarma se recorren todas, para que suenen juntas las que vencen a la vez
+    if (self->now == self->next_due) {
+        uint8_t weekday = self->now / MINUTES_PER_DAY;
+        uint16_t minute = self->now - weekday * MINUTES_PER_DAY;
+
+        self->ringing = ALARM_NONE;
+        for (uint8_t index = 0; index < ALARM_MAX_COUNT; index++) {
+            struct alarm_s * alarm = &self->alarms[index];
+
+            if (!AlarmIsDue(self, alarm, weekday, minute)) {
+                continue;
+            }
+            if (alarm->snoozed == self->now) {
+                alarm->snoozed = NO_DUE;
+            } else if (!alarm->config.recurring) {
+                alarm->config.enabled = false;
+            }
+            alarm->ringing = true;
+            if (self->ringing == ALARM_NONE) {
+                self->ringing = index;
+            }
+        }
+        self->driver->AlarmTurnOn(self->ringing);
+        AlarmsScheduleNext(self);
+        result = true;
+    }
+    return result;
+}
+
+void AlarmsSnooze(alarms_t self) {
+    if (self->ringing != ALARM_NONE) {
+        uint16_t due = self->now + self->snooze_minutes;
+
+        if (due >= MINUTES_PER_WEEK) {
+            due -= MINUTES_PER_WEEK;
+        }
+        for (uint8_t index = 0; index < ALARM_MAX_COUNT; index++) {
+            if (self->alarms[index].ringing) {
+                self->alarms[index].ringing = false;
+                self->alarms[index].snoozed = due;
+            }
+        }
+        self->ringing = ALARM_NONE;
+        self->driver->AlarmTurnOff();
+        AlarmsScheduleNext(self);
+    }
+}
+
+void AlarmsStop(alarms_t self) {
+    if (self->ringing != ALARM_NONE) {
+        self->ringing = ALARM_NONE;
+        self->driver->AlarmTurnOff();
+    }
+
+    for (uint8_t index = 0; index < ALARM_MAX_COUNT; index++) {
+        self->alarms[index].ringing = false;
+        self->alarms[index].snoozed = NO_DUE;
+    }
+    AlarmsScheduleNext(self);
+}
+
+uint8_t AlarmsRinging(alarms_t self) {
+    return self->ringing;
+}
+
+uint8_t AlarmsNext(alarms_t self, uint16_t * minutes) {
+    if ((minutes != NULL) && (self->next != ALARM_NONE)) {
+        *minutes = MinutesUntil(self, self->next_due);
+    }
+    return self->next;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -29,143 +29,687 @@ SPDX-License-Identifier: MIT
 #include "digital.h"
 #include "bsp.h"
 #include "chip.h"
+#include "config.h"
+#include "fast_gpio.h"
+#include "pool.h"
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include "poncho.h"
 
 /* === Macros definitions ========================================================================================== */
 
+//! Cantidad de digitos de la pantalla del poncho
+#define SCREEN_DIGITS       ((uint8_t)sizeof(DIGIT_BITS))
+
+//! Duracion del antirrebote de las teclas en ticks del SysTick
+#define KEYS_DEBOUNCE_TICKS ((DIGITAL_DEBOUNCE_MS * SYSTICK_RATE_HZ) / 1000)
+
+//! Entrada de la tabla de pines a partir de los nombres de poncho.h
+#define BOARD_PIN(name, output) {name##_PORT, name##_PIN, name##_FUNC, name##_GPIO, name##_BIT, output}
+
+//! Cantidad de puertos GPIO del LPC43xx
+#define BOARD_GPIO_PORTS    8
+
+//! Linea de pedido del GPDMA que se conecta al match 0 del timer 0
+#define DMA_REQUEST_LINE    1
+//! Valor del DMAMUX que conecta la linea de pedido al match 0 del timer 0
+#define DMA_REQUEST_T0_MAT0 0
+//! Cantidad total de transferencias de un barrido completo de la pantalla por DMA
+#define DMA_STEPS           (SCREEN_DIGITS * SCREEN_DMA_STEPS_PER_DIGIT)
+
+//! El brillo recorta el turno que le da a cada digito el refresco por SysTick, con DMA la pantalla solo se apaga
+#define SCREEN_DIMMING      (BOARD_SCREEN_DIMMING && !BOARD_SCREEN_DMA)
+//! Evento del SCT que marca el final del tiempo de encendido de un digito
+#define DIMMING_EVENT       0
+//! Configuracion del evento: condicion de match con el registro de match 0
+#define DIMMING_MATCH       (1 << 12)
+
+#if BOARD_RTC_TIMEBASE
+//! Registro con respaldo de bateria que indica si el RTC tiene una hora configurada
+#define RTC_VALID_REGISTER  0
+//! Valor del registro cuando la hora del RTC es valida
+#define RTC_VALID_MAGIC     0x52544331
+//! Año con el que arranca el RTC, la aplicacion solo usa la hora
+#define RTC_FIRST_YEAR      2025
+#endif
+
+#if BOARD_PPS_INPUT
+//! Timer que captura los pulsos de referencia, cuenta con el reloj del procesador igual que el SysTick
+#define REFERENCE_TIMER     LPC_TIMER2
+//! Reloj del timer que captura los pulsos de referencia
+#define REFERENCE_CLOCK     CLK_MX_TIMER2
+//! Entrada de captura del timer conectada al pin REFERENCE del poncho
+#define REFERENCE_CAPTURE   0
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
+//! Pin de la placa que se configura al arrancar
+struct board_pin_s {
+    uint8_t port;  //!< Grupo de pines del SCU
+    uint8_t pin;   //!< Pin dentro del grupo del SCU
+    uint16_t func; //!< Funcion del pin que lo conecta al GPIO
+    uint8_t gpio;  //!< Puerto GPIO
+    uint8_t bit;   //!< Bit dentro del puerto GPIO
+    bool output;   //!< true para una salida, que arranca en bajo, false para una entrada
+};
+
+//! Palabras que el DMA copia a los puertos para mostrar un digito
+enum dma_word_e {
+    DMA_WORD_SEGMENTS, //!< Segmentos A a G, se escriben en el registro MPIN del puerto de segmentos
+    DMA_WORD_POINT,    //!< Punto decimal, se escribe en el registro W del pin del punto
+    DMA_WORD_DIGIT,    //!< Habilitacion del digito, se escribe en el registro MPIN del puerto de digitos
+    DMA_WORDS,
+};
+
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Configura todos los pines de la tabla de la placa.
+ *
+ * Cada pin necesita su propio registro del SCU, pero las direcciones y el estado inicial de las salidas se acumulan
+ * por puerto y se escriben con un solo acceso por puerto.
+ */
+static void BoardPinsInit(void);
+
 void DigitsTurnOff(void);
 
 void SegmentsUpdate(uint8_t value);
 
 void DigitsTurnOn(uint8_t digit);
 
+#if BOARD_SCREEN_DMA
+/**
+ * @brief Arma la lista circular de transferencias del DMA y arranca el timer que las dispara.
+ */
+static void ScreenDmaInit(void);
+
+/**
+ * @brief Actualiza las palabras que el DMA copia a los puertos con un cuadro nuevo de la pantalla.
+ *
+ * @param images Segmentos de cada digito.
+ * @param digits Cantidad de digitos del cuadro.
+ */
+static void ScreenDmaUpdate(const uint8_t images[], uint8_t digits);
+#endif
+
+#if SCREEN_DIMMING
+/**
+ * @brief Configura el SCT para que detenga su cuenta e interrumpa al terminar el tiempo de encendido de un digito.
+ *
+ * Los pines de habilitacion de los digitos no se pueden asignar a salidas CTOUT del SCT, asi que el SCT solo mide el
+ * tiempo y el digito lo apaga la rutina de interrupcion. El error del corte es la latencia de esa interrupcion.
+ */
+static void ScreenDimmingInit(void);
+
+/**
+ * @brief Arranca la cuenta del tiempo de encendido del digito que se acaba de encender.
+ *
+ * @param digit Digito encendido.
+ * @param level Brillo del digito.
+ */
+static void ScreenDimmingStart(uint8_t digit, uint8_t level);
+#endif
+
+#if BOARD_BUZZER_TONE
+/**
+ * @brief Configura el timer 1 para que interrumpa en cada media onda del tono del zumbador.
+ */
+static void BuzzerTimerInit(void);
+#endif
+
+/**
+ * @brief Hace sonar el zumbador con la frecuencia indicada.
+ *
+ * @param frequency Frecuencia del tono en hertz.
+ */
+static void BuzzerToneStart(uint16_t frequency);
+
+/**
+ * @brief Silencia el zumbador.
+ */
+static void BuzzerToneStop(void);
+
+/**
+ * @brief Lee el comienzo de una pagina de la EEPROM.
+ *
+ * @param page Numero de pagina.
+ * @param data Donde se copian los datos.
+ * @param size Cantidad de bytes, como maximo EEPROM_PAGE_SIZE.
+ * @return int 0 si se leyo, -1 si la pagina o el tamaño no son validos.
+ */
+static int EepromRead(uint16_t page, void * data, uint16_t size);
+
+/**
+ * @brief Borra y programa el comienzo de una pagina de la EEPROM, esperando a que termine la programacion.
+ *
+ * @param page Numero de pagina.
+ * @param data Datos a escribir, alineados a palabras.
+ * @param size Cantidad de bytes, multiplo de cuatro y como maximo EEPROM_PAGE_SIZE.
+ * @return int 0 si se escribio, -1 si la pagina o el tamaño no son validos.
+ */
+static int EepromWrite(uint16_t page, const void * data, uint16_t size);
+
+#if BOARD_RTC_TIMEBASE
+/**
+ * @brief Configura el RTC para que interrumpa en cada segundo, lo arranca a medianoche si no tiene una hora valida.
+ *
+ * La interrupcion se habilita en el NVIC desde la aplicacion, cuando ya puede atenderla.
+ */
+static void RtcInit(void);
+
+/**
+ * @brief Lee la hora y el dia de la semana del RTC.
+ *
+ * @param time Donde se copia la hora en digitos BCD.
+ * @param weekday Donde se copia el dia de la semana, 0 es domingo.
+ * @return bool true si la hora es valida, false si todavia no se configuro.
+ */
+static bool RtcGetTime(clock_time_t * time, uint8_t * weekday);
+
+/**
+ * @brief Configura la hora del RTC, el primer segundo dura un segundo completo.
+ *
+ * @param time Hora en digitos BCD.
+ */
+static void RtcSetTime(const clock_time_t * time);
+
+/**
+ * @brief Configura el dia de la semana del RTC, que sigue contando sin reiniciar el segundo en curso.
+ *
+ * @param weekday Dia de la semana, 0 es domingo.
+ */
+static void RtcSetWeekday(uint8_t weekday);
+
+/**
+ * @brief Borra el pedido de interrupcion de cada segundo del RTC.
+ */
+static void RtcAcknowledge(void);
+#endif
+
+#if BOARD_PPS_INPUT
+/**
+ * @brief Configura el timer para que guarde su cuenta e interrumpa en cada flanco de subida de la referencia.
+ *
+ * La interrupcion se habilita en el NVIC desde la aplicacion, cuando ya puede atenderla.
+ */
+static void ReferenceInit(void);
+
+/**
+ * @brief Obtiene la frecuencia con la que cuenta el timer de la captura.
+ *
+ * @return uint32_t Frecuencia en hertz.
+ */
+static uint32_t ReferenceRate(void);
+
+/**
+ * @brief Lee la cuenta capturada con el ultimo pulso de referencia y borra el pedido de interrupcion.
+ *
+ * @return uint32_t Cuenta del timer en el flanco del pulso.
+ */
+static uint32_t ReferenceRead(void);
+#endif
+
 /* === Private variable definitions ================================================================================ */
 
+//! Bits del puerto DIGITS_GPIO que habilitan cada digito de la pantalla del poncho, el digito 0 es el de la izquierda
+static const uint8_t DIGIT_BITS[] = {DIGIT_4_BIT, DIGIT_3_BIT, DIGIT_2_BIT, DIGIT_1_BIT};
+
+//! Pines de la placa, para agregar uno alcanza con sumarlo a la tabla
+static const struct board_pin_s BOARD_PINS[] = {
+    BOARD_PIN(DIGIT_1, true),
+    BOARD_PIN(DIGIT_2, true),
+    BOARD_PIN(DIGIT_3, true),
+    BOARD_PIN(DIGIT_4, true),
+    BOARD_PIN(SEGMENT_A, true),
+    BOARD_PIN(SEGMENT_B, true),
+    BOARD_PIN(SEGMENT_C, true),
+    BOARD_PIN(SEGMENT_D, true),
+    BOARD_PIN(SEGMENT_E, true),
+    BOARD_PIN(SEGMENT_F, true),
+    BOARD_PIN(SEGMENT_G, true),
+    BOARD_PIN(SEGMENT_P, true),
+    BOARD_PIN(PONCHO_RGB_RED, true),
+    BOARD_PIN(PONCHO_RGB_GREEN, true),
+    BOARD_PIN(PONCHO_RGB_BLUE, true),
+    BOARD_PIN(BUZZER, true),
+    BOARD_PIN(KEY_F1, false),
+    BOARD_PIN(KEY_F2, false),
+    BOARD_PIN(KEY_F3, false),
+    BOARD_PIN(KEY_F4, false),
+    BOARD_PIN(KEY_ACCEPT, false),
+    BOARD_PIN(KEY_CANCEL, false),
+#if BOARD_PPS_INPUT
+    BOARD_PIN(REFERENCE, false),
+#endif
+};
+
+#if BOARD_SCREEN_DMA
+//! Palabras que el DMA copia a los puertos para cada digito, se modifican solo cuando cambia el cuadro
+static uint32_t dma_words[SCREEN_DIGITS][DMA_WORDS];
+
+//! Palabra que apaga todos los digitos
+static const uint32_t dma_digits_off = 0;
+
+//! Lista circular de transferencias que recorre la pantalla completa
+static DMA_TransferDescriptor_t dma_list[DMA_STEPS];
+
+static const struct screen_driver_s screen_driver = {
+    .FrameUpdate = ScreenDmaUpdate,
+};
+#else
 static const struct screen_driver_s screen_driver = {
     .DigitsTurnOff = DigitsTurnOff,
     .SegmentsUpdate = SegmentsUpdate,
     .DigitsTurnOn = DigitsTurnOn,
+#if SCREEN_DIMMING
+    .DigitBrightness = ScreenDimmingStart,
+#endif
 };
+#endif
 
-/* === Public variable definitions ================================================================================= */
+//! Driver del secuenciador del zumbador
+static const struct buzzer_driver_s buzzer_driver = {
+    .ToneStart = BuzzerToneStart,
+    .ToneStop = BuzzerToneStop,
+};
 
-/* === Private function definitions ================================================================================ */
+//! Driver de la EEPROM interna para el almacenamiento de la configuracion
+static const struct storage_driver_s eeprom_driver = {
+    .Read = EepromRead,
+    .Write = EepromWrite,
+};
 
-void DigitsInt(void) {
-    Chip_SCU_PinMuxSet(DIGIT_1_PORT, DIGIT_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_1_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, true);
+#if BOARD_RTC_TIMEBASE
+//! Driver del RTC que lleva la hora del reloj
+static const struct clock_rtc_driver_s rtc_driver = {
+    .GetTime = RtcGetTime,
+    .SetTime = RtcSetTime,
+    .SetWeekday = RtcSetWeekday,
+    .Acknowledge = RtcAcknowledge,
+};
+#endif
 
-    Chip_SCU_PinMuxSet(DIGIT_2_PORT, DIGIT_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_2_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, true);
+#if BOARD_PPS_INPUT
+//! Driver de la captura de los pulsos de referencia
+static const struct pps_capture_driver_s reference_driver = {
+    .Rate = ReferenceRate,
+    .Read = ReferenceRead,
+};
+#endif
 
-    Chip_SCU_PinMuxSet(DIGIT_3_PORT, DIGIT_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_3_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, true);
+//! Salida del zumbador, la usan el driver y la interrupcion del timer sin depender de donde se creo la placa
+static digital_output_t buzzer_output;
 
-    Chip_SCU_PinMuxSet(DIGIT_4_PORT, DIGIT_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_4_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, true);
-}
+#if SCREEN_DIMMING
+//! Cuentas del SCT que dura el turno de un digito
+static uint32_t dimming_slot_counts;
+#endif
 
-void SegmentsInit(void) {
-    Chip_SCU_PinMuxSet(SEGMENT_A_PORT, SEGMENT_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_A_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
+//! Memoria de la que se toma la placa, que se crea una sola vez
+POOL_DEFINE(BoardAllocate, struct Board_s, 1)
 
-    Chip_SCU_PinMuxSet(SEGMENT_B_PORT, SEGMENT_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_B_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
+/* === Public variable definitions ================================================================================= */
 
-    Chip_SCU_PinMuxSet(SEGMENT_C_PORT, SEGMENT_C_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_C_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
+/* === Private function definitions ================================================================================ */
 
-    Chip_SCU_PinMuxSet(SEGMENT_D_PORT, SEGMENT_D_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_D_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
+static void BoardPinsInit(void) {
+    uint32_t outputs[BOARD_GPIO_PORTS] = {0};
+    uint32_t inputs[BOARD_GPIO_PORTS] = {0};
 
-    Chip_SCU_PinMuxSet(SEGMENT_E_PORT, SEGMENT_E_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_E_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
+    for (uint8_t index = 0; index < sizeof(BOARD_PINS) / sizeof(BOARD_PINS[0]); index++) {
+        const struct board_pin_s * pin = &BOARD_PINS[index];
 
-    Chip_SCU_PinMuxSet(SEGMENT_F_PORT, SEGMENT_F_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_F_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
+        Chip_SCU_PinMuxSet(pin->port, pin->pin, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | pin->func);
+        if (pin->output) {
+            outputs[pin->gpio] |= (1UL << pin->bit);
+        } else {
+            inputs[pin->gpio] |= (1UL << pin->bit);
+        }
+    }
 
-    Chip_SCU_PinMuxSet(SEGMENT_G_PORT, SEGMENT_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_G_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
+    // Las salidas se ponen en bajo antes de cambiar la direccion para que no aparezca un pulso al arrancar
+    for (uint8_t gpio = 0; gpio < BOARD_GPIO_PORTS; gpio++) {
+        if (outputs[gpio]) {
+            Chip_GPIO_SetPortOutLow(LPC_GPIO_PORT, gpio, outputs[gpio]);
+            Chip_GPIO_SetPortDIROutput(LPC_GPIO_PORT, gpio, outputs[gpio]);
+        }
+        if (inputs[gpio]) {
+            Chip_GPIO_SetPortDIRInput(LPC_GPIO_PORT, gpio, inputs[gpio]);
+        }
+    }
 
-    Chip_SCU_PinMuxSet(SEGMENT_P_PORT, SEGMENT_P_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_P_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, true);
+    // El refresco escribe todos los digitos y todos los segmentos de una vez, sin alterar el resto de los puertos
+    FastGpioSetWritable(DIGITS_GPIO, DIGITS_MASK);
+    FastGpioSetWritable(SEGMENTS_GPIO, SEGMENTS_MASK);
 }
 
 void DigitsTurnOff(void) {
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
+    // Con los digitos apagados no hace falta borrar los segmentos, SegmentsUpdate los escribe todos juntos
+    FastGpioWriteMasked(DIGITS_GPIO, 0);
 }
 
 void SegmentsUpdate(uint8_t value) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, (value & SEGMENTS_MASK));
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, (value & SEGMENT_P));
+    FastGpioWriteMasked(SEGMENTS_GPIO, value);
+    FastGpioWriteBit(SEGMENT_P_GPIO, SEGMENT_P_BIT, (value & SEGMENT_P) != 0);
 }
 
 void DigitsTurnOn(uint8_t digit) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
+    FastGpioWriteMasked(DIGITS_GPIO, 1UL << DIGIT_BITS[digit]);
+}
+
+#if BOARD_SCREEN_DMA
+static void ScreenDmaInit(void) {
+    uint32_t control = GPDMA_DMACCxControl_TransferSize(1) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |
+                       GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD);
+    uint16_t step = 0;
+
+    // Cada digito apaga la pantalla, escribe los segmentos y el punto, y enciende su linea. Las transferencias
+    // restantes vuelven a escribir la linea del digito para mantenerlo encendido el resto de su turno.
+    for (uint8_t digit = 0; digit < SCREEN_DIGITS; digit++) {
+        dma_words[digit][DMA_WORD_DIGIT] = 1UL << DIGIT_BITS[digit];
+
+        for (uint8_t index = 0; index < SCREEN_DMA_STEPS_PER_DIGIT; index++, step++) {
+            DMA_TransferDescriptor_t * transfer = &dma_list[step];
+
+            if (index == 0) {
+                transfer->src = (uint32_t)&dma_digits_off;
+                transfer->dst = (uint32_t)&LPC_GPIO_PORT->MPIN[DIGITS_GPIO];
+            } else if (index == 1) {
+                transfer->src = (uint32_t)&dma_words[digit][DMA_WORD_SEGMENTS];
+                transfer->dst = (uint32_t)&LPC_GPIO_PORT->MPIN[SEGMENTS_GPIO];
+            } else if (index == 2) {
+                transfer->src = (uint32_t)&dma_words[digit][DMA_WORD_POINT];
+                transfer->dst = (uint32_t)&LPC_GPIO_PORT->W[SEGMENT_P_GPIO][SEGMENT_P_BIT];
+            } else {
+                transfer->src = (uint32_t)&dma_words[digit][DMA_WORD_DIGIT];
+                transfer->dst = (uint32_t)&LPC_GPIO_PORT->MPIN[DIGITS_GPIO];
+            }
+            transfer->lli = (uint32_t)&dma_list[(step + 1 < DMA_STEPS) ? step + 1 : 0];
+            transfer->ctrl = control;
+        }
+    }
+
+    Chip_GPDMA_Init(LPC_GPDMA);
+    LPC_CREG->DMAMUX = (LPC_CREG->DMAMUX & ~(0x3 << (2 * DMA_REQUEST_LINE))) |
+                       (DMA_REQUEST_T0_MAT0 << (2 * DMA_REQUEST_LINE));
+
+    LPC_GPDMA->CH[SCREEN_DMA_CHANNEL].SRCADDR = dma_list[0].src;
+    LPC_GPDMA->CH[SCREEN_DMA_CHANNEL].DESTADDR = dma_list[0].dst;
+    LPC_GPDMA->CH[SCREEN_DMA_CHANNEL].LLI = dma_list[0].lli;
+    LPC_GPDMA->CH[SCREEN_DMA_CHANNEL].CONTROL = dma_list[0].ctrl;
+    LPC_GPDMA->CH[SCREEN_DMA_CHANNEL].CONFIG = GPDMA_DMACCxConfig_E |
+                                               GPDMA_DMACCxConfig_DestPeripheral(DMA_REQUEST_LINE) |
+                                               GPDMA_DMACCxConfig_TransferType(GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+
+    // Cada match del timer pide una transferencia, el contador se reinicia solo y el procesador no interviene
+    Chip_TIMER_Init(LPC_TIMER0);
+    Chip_TIMER_Reset(LPC_TIMER0);
+    Chip_TIMER_SetMatch(LPC_TIMER0, 0,
+                        Chip_Clock_GetRate(CLK_MX_TIMER0) / (SCREEN_DMA_SLOT_RATE_HZ * SCREEN_DMA_STEPS_PER_DIGIT));
+    Chip_TIMER_ResetOnMatchEnable(LPC_TIMER0, 0);
+    Chip_TIMER_Enable(LPC_TIMER0);
+}
+
+static void ScreenDmaUpdate(const uint8_t images[], uint8_t digits) {
+    for (uint8_t digit = 0; (digit < digits) && (digit < SCREEN_DIGITS); digit++) {
+        dma_words[digit][DMA_WORD_SEGMENTS] = images[digit] & SEGMENTS_MASK;
+        dma_words[digit][DMA_WORD_POINT] = (images[digit] & SEGMENT_P) != 0;
+    }
+}
+#endif
+
+#if SCREEN_DIMMING
+static void ScreenDimmingInit(void) {
+    dimming_slot_counts = Chip_Clock_GetRate(CLK_MX_SCT) / SYSTICK_RATE_HZ;
+
+    Chip_SCT_Init(LPC_SCT);
+    Chip_SCT_Config(LPC_SCT, SCT_CONFIG_32BIT_COUNTER | SCT_CONFIG_CLKMODE_BUSCLK);
+    LPC_SCT->EVENT[DIMMING_EVENT].STATE = 1 << 0;
+    LPC_SCT->EVENT[DIMMING_EVENT].CTRL = DIMMING_MATCH;
+    LPC_SCT->HALT_L = 1 << DIMMING_EVENT;
+    Chip_SCT_EnableEventInt(LPC_SCT, SCT_EVT_0);
+
+    // Mas prioridad que el SysTick, el digito se apaga a tiempo aunque el refresco este en curso
+    NVIC_SetPriority(SCT_IRQn, (1 << __NVIC_PRIO_BITS) - 2);
+    NVIC_ClearPendingIRQ(SCT_IRQn);
+    NVIC_EnableIRQ(SCT_IRQn);
+}
+
+static void ScreenDimmingStart(uint8_t digit, uint8_t level) {
+    (void)digit;
+
+    // Se descarta cualquier cuenta del turno anterior antes de arrancar la del digito actual
+    Chip_SCT_SetControl(LPC_SCT, SCT_CTRL_HALT_L | SCT_CTRL_CLRCTR_L);
+    Chip_SCT_ClearEventFlag(LPC_SCT, SCT_EVT_0);
+    NVIC_ClearPendingIRQ(SCT_IRQn);
+
+    // Con el brillo maximo el digito queda encendido todo el turno y no hace falta interrumpir
+    if (level < SCREEN_BRIGHTNESS_MAX) {
+        LPC_SCT->MATCH[0].U = (dimming_slot_counts * level) >> 8;
+        Chip_SCT_ClearControl(LPC_SCT, SCT_CTRL_HALT_L);
+    }
+}
+
+void SCT_IRQHandler(void) {
+    Chip_SCT_ClearEventFlag(LPC_SCT, SCT_EVT_0);
+    DigitsTurnOff();
+}
+#endif
+
+#if BOARD_BUZZER_TONE
+static void BuzzerTimerInit(void) {
+    Chip_TIMER_Init(LPC_TIMER1);
+    Chip_TIMER_Reset(LPC_TIMER1);
+    Chip_TIMER_ResetOnMatchEnable(LPC_TIMER1, 0);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER1, 0);
+
+    // Mas prioridad que el SysTick, el tono no se deforma mientras se refresca la pantalla
+    NVIC_SetPriority(TIMER1_IRQn, (1 << __NVIC_PRIO_BITS) - 2);
+    NVIC_ClearPendingIRQ(TIMER1_IRQn);
+    NVIC_EnableIRQ(TIMER1_IRQn);
+}
+
+static void BuzzerToneStart(uint16_t frequency) {
+    // Cada match invierte la salida, por lo que un periodo del tono son dos matches
+    Chip_TIMER_Disable(LPC_TIMER1);
+    Chip_TIMER_SetMatch(LPC_TIMER1, 0, Chip_Clock_GetRate(CLK_MX_TIMER1) / (2UL * frequency));
+    Chip_TIMER_Reset(LPC_TIMER1);
+    Chip_TIMER_Enable(LPC_TIMER1);
+}
+
+static void BuzzerToneStop(void) {
+    Chip_TIMER_Disable(LPC_TIMER1);
+    Chip_TIMER_ClearMatch(LPC_TIMER1, 0);
+    NVIC_ClearPendingIRQ(TIMER1_IRQn);
+    DigitalOutput_Deactivate(buzzer_output);
+}
+
+void TIMER1_IRQHandler(void) {
+    Chip_TIMER_ClearMatch(LPC_TIMER1, 0);
+    DigitalOutput_Toggle(buzzer_output);
+}
+#else
+static void BuzzerToneStart(uint16_t frequency) {
+    // Un zumbador activo genera su propio tono, solo se puede encender o apagar
+    (void)frequency;
+    DigitalOutput_Activate(buzzer_output);
+}
+
+static void BuzzerToneStop(void) {
+    DigitalOutput_Deactivate(buzzer_output);
+}
+#endif
+
+static int EepromRead(uint16_t page, void * data, uint16_t size) {
+    if ((page >= EEPROM_PAGE_NUM) || (size > EEPROM_PAGE_SIZE)) {
+        return -1;
+    }
+    memcpy(data, (const void *)EEPROM_ADDRESS(page, 0), size);
+    return 0;
+}
+
+static int EepromWrite(uint16_t page, const void * data, uint16_t size) {
+    volatile uint32_t * target = (volatile uint32_t *)EEPROM_ADDRESS(page, 0);
+    const uint32_t * words = data;
+
+    if ((page >= EEPROM_PAGE_NUM) || (size > EEPROM_PAGE_SIZE) || (size % sizeof(uint32_t))) {
+        return -1;
+    }
+    // La EEPROM solo acepta escrituras de palabras en el registro de pagina, que luego se programa de una vez
+    for (uint16_t index = 0; index < size / sizeof(uint32_t); index++) {
+        target[index] = words[index];
+    }
+    Chip_EEPROM_EraseProgramPage(LPC_EEPROM);
+    Chip_EEPROM_WaitForIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+    return 0;
+}
+
+#if BOARD_RTC_TIMEBASE
+static void RtcInit(void) {
+    RTC_TIME_T midnight = {
+        .time = {[RTC_TIMETYPE_DAYOFMONTH] = 1, [RTC_TIMETYPE_DAYOFYEAR] = 1, [RTC_TIMETYPE_MONTH] = 1,
+                 [RTC_TIMETYPE_YEAR] = RTC_FIRST_YEAR},
+    };
+
+    // El RTC esta en el dominio que alimenta la bateria, si tiene una hora valida siguio contando durante el reinicio
+    if (Chip_REGFILE_Read(LPC_REGFILE, RTC_VALID_REGISTER) != RTC_VALID_MAGIC) {
+        Chip_RTC_Init(LPC_RTC);
+        Chip_RTC_SetFullTime(LPC_RTC, &midnight);
+        Chip_RTC_Enable(LPC_RTC, ENABLE);
+    }
+    Chip_RTC_CntIncrIntConfig(LPC_RTC, RTC_AMR_CIIR_IMSEC, ENABLE);
+    Chip_RTC_ClearIntPending(LPC_RTC, RTC_INT_COUNTER_INCREASE | RTC_INT_ALARM);
+}
+
+static bool RtcGetTime(clock_time_t * time, uint8_t * weekday) {
+    RTC_TIME_T full;
+
+    Chip_RTC_GetFullTime(LPC_RTC, &full);
+    time->time.hours[0] = full.time[RTC_TIMETYPE_HOUR] / 10;
+    time->time.hours[1] = full.time[RTC_TIMETYPE_HOUR] % 10;
+    time->time.minutes[0] = full.time[RTC_TIMETYPE_MINUTE] / 10;
+    time->time.minutes[1] = full.time[RTC_TIMETYPE_MINUTE] % 10;
+    time->time.seconds[0] = full.time[RTC_TIMETYPE_SECOND] / 10;
+    time->time.seconds[1] = full.time[RTC_TIMETYPE_SECOND] % 10;
+    *weekday = full.time[RTC_TIMETYPE_DAYOFWEEK];
+    return Chip_REGFILE_Read(LPC_REGFILE, RTC_VALID_REGISTER) == RTC_VALID_MAGIC;
 }
 
+static void RtcSetTime(const clock_time_t * time) {
+    RTC_TIME_T full;
+
+    Chip_RTC_GetFullTime(LPC_RTC, &full);
+    full.time[RTC_TIMETYPE_HOUR] = time->time.hours[0] * 10 + time->time.hours[1];
+    full.time[RTC_TIMETYPE_MINUTE] = time->time.minutes[0] * 10 + time->time.minutes[1];
+    full.time[RTC_TIMETYPE_SECOND] = time->time.seconds[0] * 10 + time->time.seconds[1];
+
+    // Se reinicia el divisor del cristal para que el segundo empiece al configurar la hora, como con el SysTick
+    Chip_RTC_Enable(LPC_RTC, DISABLE);
+    Chip_RTC_ResetClockTickCounter(LPC_RTC);
+    Chip_RTC_SetFullTime(LPC_RTC, &full);
+    Chip_RTC_Enable(LPC_RTC, ENABLE);
+    Chip_REGFILE_Write(LPC_REGFILE, RTC_VALID_REGISTER, RTC_VALID_MAGIC);
+}
+
+static void RtcSetWeekday(uint8_t weekday) {
+    Chip_RTC_SetTime(LPC_RTC, RTC_TIMETYPE_DAYOFWEEK, weekday);
+}
+
+static void RtcAcknowledge(void) {
+    Chip_RTC_ClearIntPending(LPC_RTC, RTC_INT_COUNTER_INCREASE);
+}
+#endif
+
+#if BOARD_PPS_INPUT
+static void ReferenceInit(void) {
+    // Sin divisor cada cuenta es un ciclo del procesador, el contador de 32 bits da la vuelta cada veinte segundos
+    Chip_TIMER_Init(REFERENCE_TIMER);
+    Chip_TIMER_Reset(REFERENCE_TIMER);
+    Chip_TIMER_PrescaleSet(REFERENCE_TIMER, 0);
+    Chip_TIMER_CaptureRisingEdgeEnable(REFERENCE_TIMER, REFERENCE_CAPTURE);
+    Chip_TIMER_CaptureEnableInt(REFERENCE_TIMER, REFERENCE_CAPTURE);
+    Chip_TIMER_Enable(REFERENCE_TIMER);
+}
+
+static uint32_t ReferenceRate(void) {
+    return Chip_Clock_GetRate(REFERENCE_CLOCK);
+}
+
+static uint32_t ReferenceRead(void) {
+    Chip_TIMER_ClearCapture(REFERENCE_TIMER, REFERENCE_CAPTURE);
+    return Chip_TIMER_ReadCapture(REFERENCE_TIMER, REFERENCE_CAPTURE);
+}
+#endif
+
 /* === Public function implementation ============================================================================== */
 
 Board_t Board_Create(void) {
-    struct Board_s * self = malloc(sizeof(struct Board_s));
+    struct Board_s * self = BoardAllocate();
 
     if (self != NULL) {
-        DigitsInt();
-        SegmentsInit();
-        self->screen = ScreenCreate(4, &screen_driver);
+        BoardPinsInit();
+        self->screen = ScreenCreate(SCREEN_DIGITS, &screen_driver);
+#if BOARD_SCREEN_DMA
+        ScreenDmaInit();
+#endif
+#if SCREEN_DIMMING
+        ScreenDimmingInit();
+#endif
 
-        Chip_SCU_PinMuxSet(PONCHO_RGB_BLUE_PORT, PONCHO_RGB_BLUE_PIN,
-                           SCU_MODE_INBUFF_EN | SCU_MODE_INACT | PONCHO_RGB_BLUE_FUNC);
         self->blue_led = DigitalOutput_Create(PONCHO_RGB_BLUE_GPIO, PONCHO_RGB_BLUE_BIT);
-
-        Chip_SCU_PinMuxSet(PONCHO_RGB_GREEN_PORT, PONCHO_RGB_GREEN_PIN,
-                           SCU_MODE_INBUFF_EN | SCU_MODE_INACT | PONCHO_RGB_GREEN_FUNC);
         self->green_led = DigitalOutput_Create(PONCHO_RGB_GREEN_GPIO, PONCHO_RGB_GREEN_BIT);
-
-        Chip_SCU_PinMuxSet(PONCHO_RGB_RED_PORT, PONCHO_RGB_RED_PIN,
-                           SCU_MODE_INBUFF_EN | SCU_MODE_INACT | PONCHO_RGB_RED_FUNC);
         self->red_led = DigitalOutput_Create(PONCHO_RGB_RED_GPIO, PONCHO_RGB_RED_BIT);
 
-        Chip_SCU_PinMuxSet(BUZZER_PORT, BUZZER_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | BUZZER_FUNC);
         self->buzzer = DigitalOutput_Create(BUZZER_GPIO, BUZZER_BIT);
+        buzzer_output = self->buzzer;
+        self->tone = &buzzer_driver;
+#if BOARD_BUZZER_TONE
+        BuzzerTimerInit();
+#endif
+
+        Chip_EEPROM_Init(LPC_EEPROM);
+        Chip_EEPROM_SetAutoProg(LPC_EEPROM, EEPROM_AUTOPROG_OFF);
+        self->eeprom = &eeprom_driver;
+
+#if BOARD_RTC_TIMEBASE
+        RtcInit();
+        self->rtc = &rtc_driver;
+#else
+        self->rtc = NULL;
+#endif
+#if BOARD_PPS_INPUT
+        ReferenceInit();
+        self->reference = &reference_driver;
+#else
+        self->reference = NULL;
+#endif
 
-        Chip_SCU_PinMuxSet(KEY_F1_PORT, KEY_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F1_FUNC);
         self->increment = DigitalInput_Create(KEY_F1_GPIO, KEY_F1_BIT, false);
-
-        Chip_SCU_PinMuxSet(KEY_F2_PORT, KEY_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F2_FUNC);
         self->decrement = DigitalInput_Create(KEY_F2_GPIO, KEY_F2_BIT, false);
-
-        Chip_SCU_PinMuxSet(KEY_F3_PORT, KEY_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F3_FUNC);
         self->set_alarm = DigitalInput_Create(KEY_F3_GPIO, KEY_F3_BIT, false);
-
-        Chip_SCU_PinMuxSet(KEY_F4_PORT, KEY_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F4_FUNC);
         self->set_time = DigitalInput_Create(KEY_F4_GPIO, KEY_F4_BIT, false);
-
-        Chip_SCU_PinMuxSet(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_ACCEPT_FUNC);
         self->accept = DigitalInput_Create(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, false);
-
-        Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_CANCEL_FUNC);
         self->cancel = DigitalInput_Create(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, false);
+
+#if DIGITAL_INPUT_INTERRUPTS
+        self->keys = NULL;
+        DigitalInput_EnableInterrupt(self->increment, 0, KEYS_DEBOUNCE_TICKS);
+        DigitalInput_EnableInterrupt(self->decrement, 1, KEYS_DEBOUNCE_TICKS);
+        DigitalInput_EnableInterrupt(self->set_alarm, 2, KEYS_DEBOUNCE_TICKS);
+        DigitalInput_EnableInterrupt(self->set_time, 3, KEYS_DEBOUNCE_TICKS);
+        DigitalInput_EnableInterrupt(self->accept, 4, KEYS_DEBOUNCE_TICKS);
+        DigitalInput_EnableInterrupt(self->cancel, 5, KEYS_DEBOUNCE_TICKS);
+#else
+        self->keys = DigitalInputGroup_Create();
+        DigitalInputGroup_Add(self->keys, self->increment);
+        DigitalInputGroup_Add(self->keys, self->decrement);
+        DigitalInputGroup_Add(self->keys, self->set_alarm);
+        DigitalInputGroup_Add(self->keys, self->set_time);
+        DigitalInputGroup_Add(self->keys, self->accept);
+        DigitalInputGroup_Add(self->keys, self->cancel);
+#endif
     }
     return self;
 }
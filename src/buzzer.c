@@ -0,0 +1,169 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file buzzer.c
+ ** @brief Codigo fuente del módulo secuenciador de tonos del zumbador.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "buzzer.h"
+#include "pool.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+struct buzzer_s {
+    buzzer_driver_t driver;             // driver que genera los tonos
+    scheduler_t scheduler;              // planificador de la tarea que avanza las notas
+    scheduler_task_t task;              // tarea que vence al terminar la nota actual
+    const buzzer_pattern_t * patterns;  // patrones de la melodia en curso
+    uint8_t count;                      // cantidad de patrones de la melodia
+    uint8_t pattern;                    // patron actual
+    uint8_t note;                       // nota actual dentro del patron
+    uint8_t repeat;                     // repeticiones completas del patron actual
+    uint8_t priority;                   // prioridad de la melodia en curso
+    bool playing;                       // indica si hay una melodia en curso
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Hace sonar la nota actual y programa su final.
+ *
+ * @param self Puntero al secuenciador.
+ */
+static void BuzzerSound(buzzer_t self);
+
+/**
+ * @brief Pasa a la nota siguiente al terminar la actual, se ejecuta desde el planificador.
+ *
+ * @param context Puntero al secuenciador.
+ */
+static void BuzzerNext(void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toma el unico secuenciador
+POOL_DEFINE(BuzzerAllocate, struct buzzer_s, 1)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void BuzzerSound(buzzer_t self) {
+    const buzzer_note_t * note = &self->patterns[self->pattern].notes[self->note];
+
+    if (note->frequency != 0) {
+        self->driver->ToneStart(note->frequency);
+    } else {
+        self->driver->ToneStop();
+    }
+    // La tarea se reprograma en el tick en que vence, las duraciones no acumulan error
+    SchedulerStart(self->scheduler, self->task, note->duration, 0);
+}
+
+static void BuzzerNext(void * context) {
+    buzzer_t self = context;
+    const buzzer_pattern_t * pattern = &self->patterns[self->pattern];
+
+    self->note++;
+    if (self->note >= pattern->count) {
+        self->note = 0;
+        if (pattern->repeats != 0) {
+            self->repeat++;
+            if (self->repeat >= pattern->repeats) {
+                self->repeat = 0;
+                self->pattern++;
+            }
+        }
+    }
+    if (self->pattern < self->count) {
+        BuzzerSound(self);
+    } else {
+        self->playing = false;
+        self->driver->ToneStop();
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+buzzer_t BuzzerCreate(scheduler_t scheduler, buzzer_driver_t driver) {
+    buzzer_t self = NULL;
+
+    if (driver != NULL) {
+        self = BuzzerAllocate();
+    }
+    if (self != NULL) {
+        self->task = SchedulerAddTask(scheduler, BuzzerNext, self);
+        if (self->task != NULL) {
+            self->scheduler = scheduler;
+            self->driver = driver;
+            self->playing = false;
+            self->driver->ToneStop();
+        } else {
+            self = NULL;
+        }
+    }
+    return self;
+}
+
+int BuzzerPlay(buzzer_t self, const buzzer_pattern_t patterns[], uint8_t count, uint8_t priority) {
+    int result = -1;
+
+    if ((self == NULL) || (patterns == NULL) || (count == 0)) {
+        return result;
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        if ((patterns[index].notes == NULL) || (patterns[index].count == 0)) {
+            return result;
+        }
+    }
+    if (!self->playing || (priority >= self->priority)) {
+        self->patterns = patterns;
+        self->count = count;
+        self->pattern = 0;
+        self->note = 0;
+        self->repeat = 0;
+        self->priority = priority;
+        self->playing = true;
+        BuzzerSound(self);
+        result = 0;
+    }
+    return result;
+}
+
+void BuzzerStop(buzzer_t self) {
+    if ((self != NULL) && self->playing) {
+        self->playing = false;
+        SchedulerStop(self->scheduler, self->task);
+        self->driver->ToneStop();
+    }
+}
+
+bool BuzzerIsPlaying(buzzer_t self) {
+    return (self != NULL) && self->playing;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,225 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clock.c
+ ** @brief Codigo fuente del módulo reloj de tiempo real en formato BCD.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de digitos de la hora que se muestran en pantalla (HH:MM)
+#define CLOCK_DISPLAY_DIGITS 4
+
+//! Partes por mil millones en la unidad
+#define CLOCK_PPB            1000000000LL
+
+/* === Private data type declarations ============================================================================== */
+
+struct clock_s {
+    clock_time_t current;      // hora actual en digitos BCD
+    clock_rtc_driver_t rtc;    // RTC que lleva la hora, NULL si se cuentan los ticks
+    uint16_t ticks_per_second; // cantidad de ticks que forman un segundo
+    uint16_t ticks;            // ticks transcurridos en el segundo actual
+    uint8_t weekday;           // dia de la semana, 0 es domingo
+    uint32_t phase;            // acumulador de fase de la correccion, desborda cuando hay que corregir un tick
+    uint32_t phase_step;       // fraccion de tick que se corrige en cada tick, en unidades de 2^-32 ticks
+    bool phase_skip;           // true si al desbordar se descarta el tick, false si se cuenta doble
+    bool valid;                // indica si la hora fue configurada
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Avanza la hora un segundo propagando el acarreo entre digitos, y el dia de la semana a medianoche.
+ *
+ * @param self Puntero al objeto reloj.
+ */
+static void ClockAdvanceSecond(struct clock_s * self);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toman los relojes
+POOL_DEFINE(ClockAllocate, struct clock_s, CLOCK_INSTANCES)
+
+//! Valor maximo admitido en cada digito de la hora, en el mismo orden que clock_time_t.bcd
+static const uint8_t DIGIT_LIMITS[CLOCK_DIGITS] = {2, 9, 5, 9, 5, 9};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ClockAdvanceSecond(struct clock_s * self) {
+    uint8_t * bcd = self->current.bcd;
+
+    // Cada digito solo se toca si el anterior desbordo, en la mayoria de los segundos hay un solo incremento
+    if (++bcd[5] < 10) {
+        return;
+    }
+    bcd[5] = 0;
+    if (++bcd[4] < 6) {
+        return;
+    }
+    bcd[4] = 0;
+    if (++bcd[3] < 10) {
+        return;
+    }
+    bcd[3] = 0;
+    if (++bcd[2] < 6) {
+        return;
+    }
+    bcd[2] = 0;
+    if ((++bcd[1] == 4) && (bcd[0] == 2)) {
+        bcd[1] = 0;
+        bcd[0] = 0;
+        if (++self->weekday == CLOCK_WEEKDAYS) {
+            self->weekday = 0;
+        }
+    } else if (bcd[1] == 10) {
+        bcd[1] = 0;
+        bcd[0]++;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+clock_bcd_t ClockCreate(uint16_t ticks_per_second, clock_rtc_driver_t rtc) {
+    clock_bcd_t self = ClockAllocate();
+
+    if (self != NULL) {
+        self->ticks_per_second = ticks_per_second;
+        self->rtc = rtc;
+        if (rtc != NULL) {
+            self->valid = rtc->GetTime(&self->current, &self->weekday);
+        }
+    }
+    return self;
+}
+
+bool ClockGetTime(clock_bcd_t self, clock_time_t * result) {
+    memcpy(result, &self->current, sizeof(clock_time_t));
+    return self->valid;
+}
+
+bool ClockSetTime(clock_bcd_t self, const clock_time_t * new_time) {
+    bool result = true;
+
+    for (uint8_t i = 0; i < CLOCK_DIGITS; i++) {
+        if (new_time->bcd[i] > DIGIT_LIMITS[i]) {
+            result = false;
+        }
+    }
+    if ((new_time->time.hours[0] == 2) && (new_time->time.hours[1] > 3)) {
+        result = false;
+    }
+
+    if (result) {
+        memcpy(&self->current, new_time, sizeof(clock_time_t));
+        self->ticks = 0;
+        self->valid = true;
+        if (self->rtc != NULL) {
+            self->rtc->SetTime(new_time);
+        }
+    }
+    return result;
+}
+
+uint8_t ClockGetWeekday(clock_bcd_t self) {
+    return self->weekday;
+}
+
+bool ClockSetWeekday(clock_bcd_t self, uint8_t weekday) {
+    if (weekday >= CLOCK_WEEKDAYS) {
+        return false;
+    }
+    self->weekday = weekday;
+    if (self->rtc != NULL) {
+        self->rtc->SetWeekday(weekday);
+    }
+    return true;
+}
+
+void ClockSetCorrection(clock_bcd_t self, int32_t ppb) {
+    uint64_t magnitude = (ppb < 0) ? -(int64_t)ppb : ppb;
+
+    // Un tick dura 1 / (1 + error) ticks verdaderos, se corrige esa fraccion de cada tick y no solo el error
+    self->phase_step = (uint32_t)((magnitude << 32) / (uint64_t)(CLOCK_PPB + ppb));
+    self->phase_skip = (ppb > 0);
+}
+
+uint16_t ClockTicksToNextSecond(clock_bcd_t self) {
+    uint16_t result;
+
+    if (self->rtc != NULL) {
+        return UINT16_MAX;
+    }
+    result = self->ticks_per_second - self->ticks;
+    // Si la correccion puede contar un tick doble el segundo puede completarse un tick antes
+    if (self->phase_step && !self->phase_skip && (result > 1)) {
+        result--;
+    }
+    return result;
+}
+
+bool ClockNewTick(clock_bcd_t self) {
+    bool result = false;
+
+    if (self->rtc != NULL) {
+        return false;
+    }
+    // La correccion se reparte de a un tick, nunca salta un segundo entero
+    self->phase += self->phase_step;
+    if (self->phase < self->phase_step) {
+        self->ticks += self->phase_skip ? 0 : 2;
+    } else {
+        self->ticks++;
+    }
+    if (self->ticks >= self->ticks_per_second) {
+        self->ticks -= self->ticks_per_second;
+        ClockAdvanceSecond(self);
+        result = true;
+    }
+    return result;
+}
+
+bool ClockNewSecond(clock_bcd_t self) {
+    if (self->rtc == NULL) {
+        return false;
+    }
+    self->rtc->Acknowledge();
+    // Se copia la hora del RTC en lugar de avanzarla, asi una interrupcion perdida no atrasa el reloj
+    self->rtc->GetTime(&self->current, &self->weekday);
+    return true;
+}
+
+void ClockDisplay(clock_bcd_t self, screen_t screen) {
+    ScreenWriteBCD(screen, self->current.bcd, CLOCK_DISPLAY_DIGITS);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -31,16 +31,47 @@ SPDX-License-Identifier: MIT
 #include <stdbool.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include "chip.h"
+#include "config.h"
+#include "fast_gpio.h"
+#include "pool.h"
 
 /* === Macros definitions ========================================================================================== */
 
+//! Cantidad de canales de interrupcion de pines del LPC43xx
+#define PININT_CHANNELS          8
+
+//! Marca de un flanco de activacion pendiente de leer en una entrada con interrupcion
+#define INPUT_EVENT_ACTIVATED    (1 << 0)
+//! Marca de un flanco de desactivacion pendiente de leer en una entrada con interrupcion
+#define INPUT_EVENT_DEACTIVATED  (1 << 1)
+
 /* === Private data type declarations ============================================================================== */
 
+/*! Estado de los miembros de un grupo de entradas que comparten un puerto, un bit por entrada */
+struct digital_group_port_s {
+    uint8_t gpio;               /*!< Puerto GPIO que se lee de una sola vez */
+    uint32_t members;           /*!< Bits del puerto que pertenecen al grupo */
+    uint32_t inverted;          /*!< Bits de entradas activas en bajo */
+    uint32_t state;             /*!< Estado de las entradas luego del antirrebote, 1 es activa */
+    uint32_t count0;            /*!< Bit menos significativo de los contadores verticales de antirrebote */
+    uint32_t count1;            /*!< Bit mas significativo de los contadores verticales de antirrebote */
+    volatile uint32_t pressed;  /*!< Flancos de activacion que todavia no se leyeron */
+    volatile uint32_t released; /*!< Flancos de desactivacion que todavia no se leyeron */
+};
+
+/*! Estructura que representa un grupo de entradas digitales que se leen y filtran juntas */
+struct digital_input_group_s {
+    uint8_t count;                                                 /*!< Cantidad de puertos usados */
+    struct digital_group_port_s ports[DIGITAL_GROUP_MAX_PORTS]; /*!< Puertos con entradas del grupo */
+};
+
 /*! Estructura que representa una salida digital*/
 struct digital_output_s {
-    uint8_t port; /*!< Puerto de la salida digital */
-    uint8_t pin;  /*!< Pin de la salida digital */
+    uint8_t port;  /*!< Puerto de la salida digital */
+    uint8_t pin;   /*!< Pin de la salida digital */
+    uint32_t mask; /*!< Mascara del pin dentro del puerto, precalculada para los registros SET, CLR y NOT */
 };
 
 /*! Estructura que representa una entrada digital*/
@@ -49,59 +80,175 @@ struct digital_input_s {
     uint8_t pin;     /*!< Pin de la entrada digital */
     bool inverted;   /*!< logica de entrada digital */
     bool last_state; /*!< Estado anterior de la entrada digital */
+    uint32_t mask;   /*!< Mascara del pin dentro del puerto */
+    struct digital_group_port_s * group; /*!< Puerto del grupo al que pertenece la entrada, NULL si no esta agrupada */
+#if DIGITAL_INPUT_INTERRUPTS
+    bool interrupt;           /*!< Indica si la entrada se atiende por interrupcion */
+    bool stable;              /*!< Estado de la entrada luego del antirrebote */
+    uint8_t channel;          /*!< Canal de interrupcion de pines asignado a la entrada */
+    uint16_t debounce_ticks;  /*!< Ticks que se espera luego de un flanco antes de leer la entrada */
+    uint16_t debounce;        /*!< Ticks que faltan para terminar el antirrebote en curso */
+    volatile uint8_t events;  /*!< Flancos detectados que todavia no se leyeron */
+#endif
 };
 
 /* === Private function declarations =============================================================================== */
 
+#if DIGITAL_INPUT_INTERRUPTS
+/**
+ * @brief Atiende la interrupcion de un canal de pines y arranca el antirrebote de la entrada asignada.
+ *
+ * @param channel Canal de interrupcion de pines que genero la interrupcion.
+ */
+static void DigitalInput_PinInterrupt(uint8_t channel);
+
+/**
+ * @brief Habilita las interrupciones por ambos flancos de un canal de pines.
+ *
+ * @param channel Canal de interrupcion de pines.
+ */
+static void DigitalInput_ArmChannel(uint8_t channel);
+#endif
+
 /* === Private variable definitions ================================================================================ */
 
+//! Memoria de la que se toman los grupos de entradas digitales
+POOL_DEFINE(DigitalInputGroup_Allocate, struct digital_input_group_s, DIGITAL_GROUP_INSTANCES)
+
+//! Memoria de la que se toman las entradas digitales
+POOL_DEFINE(DigitalInput_Allocate, struct digital_input_s, DIGITAL_INPUT_INSTANCES)
+
+//! Memoria de la que se toman las salidas digitales
+POOL_DEFINE(DigitalOutput_Allocate, struct digital_output_s, DIGITAL_OUTPUT_INSTANCES)
+
+#if DIGITAL_INPUT_INTERRUPTS
+//! Entradas asignadas a cada canal de interrupcion de pines
+static digital_input_t pinint_inputs[PININT_CHANNELS];
+
+//! Mascara de canales con un antirrebote en curso
+static volatile uint8_t debounce_pending;
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+#if DIGITAL_INPUT_INTERRUPTS
+static void DigitalInput_ArmChannel(uint8_t channel) {
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, PININTCH(channel));
+}
+
+static void DigitalInput_PinInterrupt(uint8_t channel) {
+    digital_input_t self = pinint_inputs[channel];
+
+    // Los rebotes no vuelven a interrumpir, el canal queda deshabilitado hasta que termina el antirrebote
+    Chip_PININT_DisableIntLow(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_DisableIntHigh(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+
+    if (self != NULL) {
+        self->debounce = self->debounce_ticks;
+        debounce_pending |= (1 << channel);
+    }
+}
+
+void PIN_INT0_IRQHandler(void) {
+    DigitalInput_PinInterrupt(0);
+}
+
+void PIN_INT1_IRQHandler(void) {
+    DigitalInput_PinInterrupt(1);
+}
+
+void PIN_INT2_IRQHandler(void) {
+    DigitalInput_PinInterrupt(2);
+}
+
+void PIN_INT3_IRQHandler(void) {
+    DigitalInput_PinInterrupt(3);
+}
+
+void PIN_INT4_IRQHandler(void) {
+    DigitalInput_PinInterrupt(4);
+}
+
+void PIN_INT5_IRQHandler(void) {
+    DigitalInput_PinInterrupt(5);
+}
+
+void PIN_INT6_IRQHandler(void) {
+    DigitalInput_PinInterrupt(6);
+}
+
+void PIN_INT7_IRQHandler(void) {
+    DigitalInput_PinInterrupt(7);
+}
+#endif
+
 /* === Public function implementation ============================================================================== */
 
 digital_output_t DigitalOutput_Create(uint8_t port, uint8_t pin) {
-    digital_output_t self = malloc(sizeof(struct digital_output_s));
+    digital_output_t self = DigitalOutput_Allocate();
     if (self != NULL) {
         self->port = port;
         self->pin = pin;
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, true);
+        self->mask = 1UL << pin;
     }
     return self;
 }
 
+void DigitalOutput_Configure(digital_output_t self) {
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
+    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, true);
+}
+
 void DigitalOutput_Activate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, true);
+    FastGpioSet(self->port, self->mask);
 }
 
 void DigitalOutput_Deactivate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
+    FastGpioClear(self->port, self->mask);
 }
 
 void DigitalOutput_Toggle(digital_output_t self) {
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->port, self->pin);
+    FastGpioToggle(self->port, self->mask);
 }
 
 /*-----------------------------------------------------------------------------------*/
 
 digital_input_t DigitalInput_Create(uint8_t gpio, uint8_t bit, bool inverted) {
-    digital_input_t self = malloc(sizeof(struct digital_input_s));
+    digital_input_t self = DigitalInput_Allocate();
     if (self != NULL) {
         self->port = gpio;
         self->pin = bit;
         self->inverted = inverted;
-
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, false);
-
+        self->mask = 1UL << bit;
+        self->group = NULL;
+#if DIGITAL_INPUT_INTERRUPTS
+        self->interrupt = false;
+#endif
         self->last_state = DigitalInput_GetIsActive(self);
     }
     return self;
 }
 
+void DigitalInput_Configure(digital_input_t self) {
+    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, false);
+    self->last_state = DigitalInput_GetIsActive(self);
+}
+
 bool DigitalInput_GetIsActive(digital_input_t self) {
-    bool state = Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, self->port, self->pin) !=0;
+    if (self->group != NULL) {
+        return (self->group->state & self->mask) != 0;
+    }
+#if DIGITAL_INPUT_INTERRUPTS
+    if (self->interrupt) {
+        return self->stable;
+    }
+#endif
+    bool state = FastGpioReadBit(self->port, self->pin);
 
     if (self->inverted) {
         state = !state;
@@ -113,11 +260,37 @@ digital_state_t Digital_WasChanged(digital_input_t self) {
 
     digital_state_t result = DIGITAL_INPUT_WAS_CHANGED;
 
+    // Las entradas agrupadas leen los flancos que detecto la ultima actualizacion del grupo
+    if (self->group != NULL) {
+        if (self->group->pressed & self->mask) {
+            __atomic_fetch_and(&self->group->pressed, ~self->mask, __ATOMIC_SEQ_CST);
+            result = DIGITAL_INPUT_WAS_ACTIVATED;
+        } else if (self->group->released & self->mask) {
+            __atomic_fetch_and(&self->group->released, ~self->mask, __ATOMIC_SEQ_CST);
+            result = DIGITAL_INPUT_WAS_DEACTIVATED;
+        }
+        return result;
+    }
+
+#if DIGITAL_INPUT_INTERRUPTS
+    // Con interrupciones se entregan los flancos guardados de a uno, asi una pulsacion corta informa los dos
+    if (self->interrupt) {
+        if (self->events & INPUT_EVENT_ACTIVATED) {
+            __atomic_fetch_and(&self->events, (uint8_t)~INPUT_EVENT_ACTIVATED, __ATOMIC_SEQ_CST);
+            result = DIGITAL_INPUT_WAS_ACTIVATED;
+        } else if (self->events & INPUT_EVENT_DEACTIVATED) {
+            __atomic_fetch_and(&self->events, (uint8_t)~INPUT_EVENT_DEACTIVATED, __ATOMIC_SEQ_CST);
+            result = DIGITAL_INPUT_WAS_DEACTIVATED;
+        }
+        return result;
+    }
+#endif
+
     bool state = DigitalInput_GetIsActive(self);
 
-    if (state && self->last_state) {
+    if (state && !self->last_state) {
         result = DIGITAL_INPUT_WAS_ACTIVATED;
-    } else if (!state && !self->last_state) {
+    } else if (!state && self->last_state) {
         result = DIGITAL_INPUT_WAS_DEACTIVATED;
     }
     self->last_state = state;
@@ -132,4 +305,121 @@ bool Digitalt_WasDeactivated(digital_input_t self) {
     return DIGITAL_INPUT_WAS_DEACTIVATED == Digital_WasChanged(self);
 }
 
+digital_input_group_t DigitalInputGroup_Create(void) {
+    return DigitalInputGroup_Allocate();
+}
+
+int DigitalInputGroup_Add(digital_input_group_t self, digital_input_t input) {
+    struct digital_group_port_s * port = NULL;
+    int result = 0;
+
+    for (uint8_t index = 0; index < self->count; index++) {
+        if (self->ports[index].gpio == input->port) {
+            port = &self->ports[index];
+        }
+    }
+    if ((port == NULL) && (self->count < DIGITAL_GROUP_MAX_PORTS)) {
+        port = &self->ports[self->count++];
+        port->gpio = input->port;
+    }
+
+    if ((port == NULL) || (input->group != NULL)) {
+        result = -1;
+    } else {
+        port->members |= input->mask;
+        if (input->inverted) {
+            port->inverted |= input->mask;
+        }
+        // El estado inicial se toma sin antirrebote y los contadores arrancan en reposo
+        if (DigitalInput_GetIsActive(input)) {
+            port->state |= input->mask;
+        }
+        port->count0 |= input->mask;
+        port->count1 |= input->mask;
+        input->group = port;
+    }
+    return result;
+}
+
+bool DigitalInputGroup_Update(digital_input_group_t self) {
+    uint32_t edges = 0;
+
+    for (uint8_t index = 0; index < self->count; index++) {
+        struct digital_group_port_s * port = &self->ports[index];
+        uint32_t sample = FastGpioReadPort(port->gpio) ^ port->inverted;
+        uint32_t changed = (sample ^ port->state) & port->members;
+
+        // Contadores verticales de dos bits: cada bit que difiere del estado estable cuenta una muestra, y los que
+        // coinciden vuelven a cero. Un bit cambia de estado luego de cuatro muestras seguidas distintas.
+        port->count0 = ~(port->count0 & changed);
+        port->count1 = port->count0 ^ (port->count1 & changed);
+        changed &= port->count0 & port->count1;
+
+        port->state ^= changed;
+        port->pressed |= changed & port->state;
+        port->released |= changed & ~port->state;
+        edges |= changed;
+    }
+    return edges != 0;
+}
+
+#if DIGITAL_INPUT_INTERRUPTS
+int DigitalInput_EnableInterrupt(digital_input_t self, uint8_t channel, uint16_t debounce_ticks) {
+    int result = 0;
+
+    if ((self == NULL) || (channel >= PININT_CHANNELS) || (pinint_inputs[channel] != NULL)) {
+        result = -1;
+    } else {
+        self->channel = channel;
+        self->debounce_ticks = (debounce_ticks != 0) ? debounce_ticks : 1;
+        self->stable = DigitalInput_GetIsActive(self);
+        self->events = 0;
+        self->interrupt = true;
+        pinint_inputs[channel] = self;
+
+        Chip_PININT_Init(LPC_GPIO_PIN_INT);
+        Chip_SCU_GPIOIntPinSel(channel, self->port, self->pin);
+        Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, PININTCH(channel));
+        DigitalInput_ArmChannel(channel);
+
+        // Misma prioridad que el SysTick, la interrupcion de pines y el antirrebote nunca se interrumpen entre si
+        NVIC_SetPriority((IRQn_Type)(PIN_INT0_IRQn + channel), (1 << __NVIC_PRIO_BITS) - 1);
+        NVIC_ClearPendingIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+        NVIC_EnableIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+    }
+    return result;
+}
+
+bool DigitalInput_DebounceTick(void) {
+    uint8_t pending = debounce_pending;
+    bool result = false;
+
+    while (pending) {
+        uint8_t channel = __builtin_ctz(pending);
+        digital_input_t self = pinint_inputs[channel];
+
+        pending &= ~(1 << channel);
+        if (--self->debounce == 0) {
+            bool state;
+
+            // El canal se arma antes de leer el pin, un flanco posterior a la lectura vuelve a interrumpir y no se
+            // pierde al borrar el pedido pendiente
+            debounce_pending &= ~(1 << channel);
+            DigitalInput_ArmChannel(channel);
+            state = FastGpioReadBit(self->port, self->pin) != self->inverted;
+            if (state != self->stable) {
+                self->stable = state;
+                self->events |= state ? INPUT_EVENT_ACTIVATED : INPUT_EVENT_DEACTIVATED;
+                result = true;
+            }
+        }
+    }
+    return result;
+}
+
+bool DigitalInput_DebounceActive(void) {
+    return debounce_pending != 0;
+}
+#endif
+
 /* === End of documentation ======================================================================================== */
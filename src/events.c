@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file events.c
+ ** @brief Codigo fuente del módulo de cola de eventos entre las interrupciones y el lazo principal.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "events.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#if (EVENT_QUEUE_SIZE < 2) || (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) || (EVENT_QUEUE_SIZE > 32768)
+#error "EVENT_QUEUE_SIZE debe ser una potencia de dos entre 2 y 32768"
+#endif
+
+//! Mascara que convierte un indice libre en una posicion del buffer
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+struct event_queue_s {
+    event_t buffer[EVENT_QUEUE_SIZE]; // eventos almacenados
+    volatile uint16_t head;           // indice de escritura, solo lo modifica el productor
+    volatile uint16_t tail;           // indice de lectura, solo lo modifica el consumidor
+    volatile uint16_t overflows;      // eventos descartados por cola llena, solo lo modifica el productor
+    volatile uint16_t high_water;     // maxima ocupacion registrada, solo lo modifica el productor
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toman las colas de eventos
+POOL_DEFINE(EventQueue_Allocate, struct event_queue_s, EVENT_QUEUE_INSTANCES)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+event_queue_t EventQueue_Create(void) {
+    return EventQueue_Allocate();
+}
+
+bool EventQueue_Push(event_queue_t self, const event_t * event) {
+    bool result = false;
+    uint16_t head = self->head;
+    uint16_t used = head - self->tail;
+
+    // Los indices corren libres y solo se enmascaran al acceder al buffer, asi una cola llena se distingue de una vacia
+    if (used >= EVENT_QUEUE_SIZE) {
+        self->overflows++;
+    } else {
+        self->buffer[head & EVENT_QUEUE_MASK] = *event;
+        __sync_synchronize();
+        self->head = head + 1;
+        if (used + 1 > self->high_water) {
+            self->high_water = used + 1;
+        }
+        result = true;
+    }
+    return result;
+}
+
+bool EventQueue_Pop(event_queue_t self, event_t * event) {
+    bool result = false;
+    uint16_t tail = self->tail;
+
+    if (tail != self->head) {
+        __sync_synchronize();
+        *event = self->buffer[tail & EVENT_QUEUE_MASK];
+        __sync_synchronize();
+        self->tail = tail + 1;
+        result = true;
+    }
+    return result;
+}
+
+bool EventQueue_IsEmpty(event_queue_t self) {
+    return self->tail == self->head;
+}
+
+uint16_t EventQueue_Overflows(event_queue_t self) {
+    return self->overflows;
+}
+
+uint16_t EventQueue_HighWater(event_queue_t self) {
+    return self->high_water;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,325 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file gesture.c
+ ** @brief Codigo fuente del módulo de reconocimiento de gestos de las teclas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "gesture.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#if GESTURE_MAX_KEYS > 8
+#error "GESTURE_MAX_KEYS no puede ser mayor que 8, los acordes usan mascaras de ocho bits"
+#endif
+
+//! Opciones validas de una tecla
+#define GESTURE_OPTIONS (GESTURE_OPTION_LONG_PRESS | GESTURE_OPTION_REPEAT)
+
+/* === Private data type declarations ============================================================================== */
+
+struct gesture_key_s {
+    uint16_t pressed_at; // marca de tiempo de la pulsacion
+    uint16_t deadline;   // marca de tiempo del proximo vencimiento
+    uint8_t options;     // gestos que genera mientras se mantiene presionada
+    uint8_t repeats;     // repeticiones generadas desde la pulsacion, hasta GESTURE_REPEAT_ACCELERATE
+    bool timed;          // indica si deadline esta vigente
+    bool pending;        // la pulsacion se demora esperando a las demas teclas de un acorde
+    bool chorded;        // la tecla completo un acorde y no genera gestos hasta que se libera
+};
+
+struct gestures_s {
+    struct gesture_key_s keys[GESTURE_MAX_KEYS]; // estado de cada tecla
+    uint8_t chords[GESTURE_MAX_CHORDS];          // mascara de teclas de cada acorde
+    uint8_t chords_count;                        // cantidad de acordes agregados
+    uint8_t held;                                // mascara de teclas presionadas
+    scheduler_t scheduler;                       // planificador que da la hora
+    scheduler_task_t task;                       // tarea que vence en el plazo mas cercano
+    gesture_handler_t handler;                   // funcion que recibe los gestos
+    void * context;                              // parametro de la funcion
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el tiempo entre dos marcas, correcto aunque el contador de 16 bits haya dado la vuelta.
+ *
+ * @param from Marca de tiempo inicial.
+ * @param to Marca de tiempo final.
+ * @return int16_t Milisegundos de from a to, negativo si to es anterior.
+ */
+static int16_t GestureElapsed(uint16_t from, uint16_t to);
+
+/**
+ * @brief Informa la pulsacion de una tecla y programa el primer vencimiento mientras se mantenga presionada.
+ *
+ * @param self Puntero al reconocedor.
+ * @param key Numero de tecla.
+ */
+static void GestureAccept(gestures_t self, uint8_t key);
+
+/**
+ * @brief Procesa el vencimiento de una tecla.
+ *
+ * @param self Puntero al reconocedor.
+ * @param key Numero de tecla.
+ * @param now Marca de tiempo actual.
+ */
+static void GestureExpire(gestures_t self, uint8_t key, uint16_t now);
+
+/**
+ * @brief Busca un acorde que se completa con la tecla presionada mientras sus demas teclas esperan.
+ *
+ * @param self Puntero al reconocedor.
+ * @param key Numero de tecla que se acaba de presionar.
+ * @return int Numero del acorde o -1 si no se completo ninguno.
+ */
+static int GestureFindChord(gestures_t self, uint8_t key);
+
+/**
+ * @brief Programa la tarea en el plazo mas cercano de todas las teclas, o la detiene si no queda ninguno.
+ *
+ * @param self Puntero al reconocedor.
+ */
+static void GestureSchedule(gestures_t self);
+
+/**
+ * @brief Vence los plazos cumplidos, se ejecuta desde el planificador.
+ *
+ * @param context Puntero al reconocedor.
+ */
+static void GestureTimeout(void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toma el unico reconocedor de gestos
+POOL_DEFINE(GesturesAllocate, struct gestures_s, 1)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static int16_t GestureElapsed(uint16_t from, uint16_t to) {
+    return (int16_t)(uint16_t)(to - from);
+}
+
+static void GestureAccept(gestures_t self, uint8_t key) {
+    struct gesture_key_s * state = &self->keys[key];
+
+    state->pending = false;
+    state->repeats = 0;
+    state->timed = true;
+    if (state->options & GESTURE_OPTION_LONG_PRESS) {
+        state->deadline = state->pressed_at + GESTURE_LONG_PRESS_MS;
+    } else if (state->options & GESTURE_OPTION_REPEAT) {
+        state->deadline = state->pressed_at + GESTURE_REPEAT_DELAY_MS;
+    } else {
+        state->timed = false;
+    }
+    self->handler(GESTURE_PRESS, key, self->context);
+}
+
+static void GestureExpire(gestures_t self, uint8_t key, uint16_t now) {
+    struct gesture_key_s * state = &self->keys[key];
+    uint16_t period;
+
+    if (state->pending) {
+        // Paso el plazo del acorde sin que se completara, la pulsacion se informa con su tiempo original
+        GestureAccept(self, key);
+    } else if (state->options & GESTURE_OPTION_LONG_PRESS) {
+        state->timed = false;
+        self->handler(GESTURE_LONG_PRESS, key, self->context);
+    } else {
+        if (state->repeats < GESTURE_REPEAT_ACCELERATE) {
+            state->repeats++;
+        }
+        period = (state->repeats < GESTURE_REPEAT_ACCELERATE) ? GESTURE_REPEAT_SLOW_MS : GESTURE_REPEAT_FAST_MS;
+
+        // La cadencia se mide desde el vencimiento anterior, si el lazo se atraso no se recuperan las repeticiones
+        state->deadline += period;
+        if (GestureElapsed(state->deadline, now) >= 0) {
+            state->deadline = now + period;
+        }
+        self->handler(GESTURE_REPEAT, key, self->context);
+    }
+}
+
+static int GestureFindChord(gestures_t self, uint8_t key) {
+    for (uint8_t chord = 0; chord < self->chords_count; chord++) {
+        uint8_t keys = self->chords[chord];
+        bool waiting = true;
+
+        if (!(keys & (1 << key)) || ((self->held & keys) != keys)) {
+            continue;
+        }
+        // Las demas teclas tienen que estar esperando, si alguna ya se informo como pulsacion no hay acorde
+        for (uint8_t other = 0; other < GESTURE_MAX_KEYS; other++) {
+            if ((other != key) && (keys & (1 << other)) && !self->keys[other].pending) {
+                waiting = false;
+            }
+        }
+        if (waiting) {
+            return chord;
+        }
+    }
+    return -1;
+}
+
+static void GestureSchedule(gestures_t self) {
+    uint16_t now = (uint16_t)SchedulerGetTime(self->scheduler);
+    int16_t delay = INT16_MAX;
+    bool timed = false;
+
+    for (uint8_t key = 0; key < GESTURE_MAX_KEYS; key++) {
+        if (self->keys[key].timed) {
+            int16_t remaining = GestureElapsed(now, self->keys[key].deadline);
+
+            if (remaining < delay) {
+                delay = remaining;
+            }
+            timed = true;
+        }
+    }
+    if (timed) {
+        // Un plazo ya vencido se atiende en el tick siguiente
+        SchedulerStart(self->scheduler, self->task, (delay > 0) ? (uint32_t)delay : 0, 0);
+    } else {
+        SchedulerStop(self->scheduler, self->task);
+    }
+}
+
+static void GestureTimeout(void * context) {
+    gestures_t self = context;
+    uint16_t now = (uint16_t)SchedulerGetTime(self->scheduler);
+
+    for (uint8_t key = 0; key < GESTURE_MAX_KEYS; key++) {
+        struct gesture_key_s * state = &self->keys[key];
+
+        if (state->timed && (GestureElapsed(state->deadline, now) >= 0)) {
+            GestureExpire(self, key, now);
+        }
+    }
+    GestureSchedule(self);
+}
+
+/* === Public function implementation ============================================================================== */
+
+gestures_t GesturesCreate(scheduler_t scheduler, gesture_handler_t handler, void * context) {
+    gestures_t self = NULL;
+
+    if ((scheduler != NULL) && (handler != NULL)) {
+        self = GesturesAllocate();
+    }
+    if (self != NULL) {
+        self->task = SchedulerAddTask(scheduler, GestureTimeout, self);
+        if (self->task != NULL) {
+            self->scheduler = scheduler;
+            self->handler = handler;
+            self->context = context;
+        } else {
+            self = NULL;
+        }
+    }
+    return self;
+}
+
+int GesturesConfigure(gestures_t self, uint8_t key, uint8_t options) {
+    int result = -1;
+
+    if ((self != NULL) && (key < GESTURE_MAX_KEYS) && !(options & ~GESTURE_OPTIONS) && (options != GESTURE_OPTIONS)) {
+        self->keys[key].options = options;
+        result = 0;
+    }
+    return result;
+}
+
+int GesturesAddChord(gestures_t self, uint8_t keys) {
+    int result = -1;
+
+    // Una mascara con un solo bit, o ninguno, no es un acorde
+    if ((self != NULL) && (self->chords_count < GESTURE_MAX_CHORDS) && (keys & (keys - 1)) &&
+        !(keys & ~((1U << GESTURE_MAX_KEYS) - 1))) {
+        result = self->chords_count;
+        self->chords[self->chords_count++] = keys;
+    }
+    return result;
+}
+
+void GesturesKeyEvent(gestures_t self, uint8_t key, bool pressed, uint16_t timestamp) {
+    struct gesture_key_s * state;
+    int chord;
+
+    if ((self == NULL) || (key >= GESTURE_MAX_KEYS)) {
+        return;
+    }
+    state = &self->keys[key];
+
+    if (pressed) {
+        self->held |= (1 << key);
+        state->pressed_at = timestamp;
+        state->chorded = false;
+        chord = GestureFindChord(self, key);
+        if (chord >= 0) {
+            for (uint8_t other = 0; other < GESTURE_MAX_KEYS; other++) {
+                if (self->chords[chord] & (1 << other)) {
+                    self->keys[other].pending = false;
+                    self->keys[other].timed = false;
+                    self->keys[other].chorded = true;
+                }
+            }
+            self->handler(GESTURE_CHORD, (uint8_t)chord, self->context);
+        } else {
+            for (chord = 0; chord < self->chords_count; chord++) {
+                if (self->chords[chord] & (1 << key)) {
+                    state->pending = true;
+                }
+            }
+            if (state->pending) {
+                state->deadline = timestamp + GESTURE_CHORD_MS;
+                state->timed = true;
+            } else {
+                GestureAccept(self, key);
+            }
+        }
+    } else {
+        self->held &= ~(1 << key);
+        state->timed = false;
+        if (state->chorded) {
+            state->chorded = false;
+        } else {
+            // Una tecla que se libera antes de vencer el plazo del acorde informa los dos flancos juntos
+            if (state->pending) {
+                GestureAccept(self, key);
+                state->timed = false;
+            }
+            self->handler(GESTURE_RELEASE, key, self->context);
+        }
+    }
+    GestureSchedule(self);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -41,93 +41,611 @@
 /* === Headers files inclusions =============================================================== */
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "alarm.h"
 #include "bsp.h"
+#include "buzzer.h"
+#include "chip.h"
+#include "clock.h"
+#include "config.h"
+#include "events.h"
+#include "gesture.h"
+#include "power.h"
+#include "pps.h"
+#include "profile.h"
+#include "scheduler.h"
+#include "storage.h"
+#include "ui.h"
 
 /* === Macros definitions ====================================================================== */
 
+//! Cantidad de interrupciones del SysTick entre lecturas del grupo de teclas
+#define KEYS_SAMPLE_TICKS ((SYSTICK_RATE_HZ * DIGITAL_GROUP_SAMPLE_MS) / 1000)
+
+//! Frecuencia del tono de la alarma, en hertz
+#define ALARM_TONE_HZ     2000
+//! Frecuencia del tono de la alarma cuando ya sono un tiempo, en hertz
+#define ALARM_URGENT_HZ   2500
+//! Frecuencia del sonido de las teclas, en hertz
+#define CLICK_TONE_HZ     4000
+
+//! Prioridad de la melodia de las teclas, no interrumpe a la alarma
+#define PRIORITY_CLICK    0
+//! Prioridad de la melodia de la alarma
+#define PRIORITY_ALARM    1
+
+//! Acorde de aceptar y cancelar, apaga o enciende la pantalla
+#define CHORD_DISPLAY     0
+//! Acorde de las dos teclas de configuracion, habilita o deshabilita el sonido de las teclas
+#define CHORD_CLICK       1
+
+//! Version del formato de la configuracion guardada, se incrementa al cambiar settings_s
+#define SETTINGS_VERSION  2
+
+#if BOARD_PPS_INPUT && BOARD_RTC_TIMEBASE
+#error "Los pulsos de referencia corrigen la frecuencia del SysTick, necesitan BOARD_RTC_TIMEBASE en cero"
+#endif
+
 /* === Private data type declarations ========================================================== */
 
+//! Configuracion que se conserva entre arranques
+struct settings_s {
+    alarm_config_t alarms[ALARM_MAX_COUNT]; //!< Alarmas configuradas
+    int32_t correction;                     //!< Error de frecuencia del SysTick medido con la referencia, en ppb
+    uint8_t brightness;                     //!< Brillo de la pantalla, 0 si se apago con el acorde
+    bool click;                             //!< Indica si las teclas suenan al presionarlas
+};
+
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Configura el SysTick para generar interrupciones periodicas.
+ *
+ * @param ticks_per_second Cantidad de interrupciones por segundo.
+ */
+static void SysTickInit(uint32_t ticks_per_second);
+
+#if BOARD_RTC_TIMEBASE
+/**
+ * @brief Habilita la interrupcion de cada segundo del RTC, con la misma prioridad que el SysTick.
+ *
+ * Como ninguna de las dos interrupciones puede interrumpir a la otra, la cola de eventos sigue teniendo un unico
+ * productor a la vez.
+ */
+static void RtcInterruptInit(void);
+#endif
+
+#if BOARD_PPS_INPUT
+/**
+ * @brief Habilita la interrupcion de la captura de los pulsos de referencia, con la misma prioridad que el SysTick.
+ *
+ * Como con el RTC, la cola de eventos sigue teniendo un unico productor a la vez.
+ */
+static void ReferenceInterruptInit(void);
+
+/**
+ * @brief Aplica al reloj la ultima estimacion del error de frecuencia y la registra para guardarla si cambio.
+ */
+static void ReferenceUpdate(void);
+#endif
+
+/**
+ * @brief Agrega a la cola el evento de un segundo nuevo, indicando si tambien empezo un minuto.
+ *
+ * Se llama desde la interrupcion que lleva la hora, el SysTick o el RTC.
+ */
+static void SecondPostEvent(void);
+
+/**
+ * @brief Enciende el zumbador cuando empieza a sonar una alarma.
+ *
+ * @param alarm Numero de la alarma que suena.
+ */
+static void AlarmTurnOn(uint8_t alarm);
+
+/**
+ * @brief Apaga el zumbador cuando se apaga o se pospone una alarma.
+ */
+static void AlarmTurnOff(void);
+
+/**
+ * @brief Cambia el estado del led verde, se ejecuta periodicamente desde el planificador.
+ *
+ * @param context Salida digital del led.
+ */
+static void Heartbeat(void * context);
+
+/**
+ * @brief Agrega a la cola un evento por cada flanco pendiente de las teclas.
+ *
+ * Se llama desde el SysTick, que es el unico productor de la cola de eventos.
+ */
+static void KeysPostEvents(void);
+
+/**
+ * @brief Convierte los gestos de las teclas en eventos de la interfaz, se llama desde el lazo principal.
+ *
+ * @param gesture Gesto reconocido.
+ * @param key Tecla que lo genero, o numero de acorde para GESTURE_CHORD.
+ * @param context No se usa.
+ */
+static void HandleGesture(gesture_t gesture, uint8_t key, void * context);
+
+/**
+ * @brief Registra la configuracion actual para guardarla, solo se escribe si cambio y cuando se dejo de modificar.
+ */
+static void SettingsSave(void);
+
+/**
+ * @brief Recupera la configuracion guardada, si no hay ninguna se conserva la configuracion inicial.
+ */
+static void SettingsRestore(void);
+
+/**
+ * @brief Enciende la pantalla y avisa a la interfaz que empezo a sonar una alarma.
+ */
+static void AlarmDue(void);
+
+/**
+ * @brief Procesa un evento en el lazo principal.
+ *
+ * @param event Evento a procesar.
+ */
+static void HandleEvent(const event_t * event);
+
+
+/**
+ * @brief Indica si el lazo principal tiene eventos o tareas pendientes, se llama con las interrupciones deshabilitadas.
+ *
+ * @return bool true si hay trabajo pendiente.
+ */
+static bool WorkPending(void);
+
+/**
+ * @brief Indica cuantos ticks faltan para el proximo tick que tiene trabajo, se llama con las interrupciones
+ * deshabilitadas.
+ *
+ * Con la pantalla encendida hay que refrescarla en cada tick, aunque tenga poco brillo. Con la pantalla apagada solo
+ * hacen falta los ticks en que cambia el segundo, si no lo indica el RTC, vence una tarea, se lee el grupo de teclas o
+ * avanza un antirrebote.
+ *
+ * @return uint32_t Ticks contados desde la ultima interrupcion del SysTick.
+ */
+static uint32_t NextDeadline(void);
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
-/* === Private function implementation ========================================================= */
+//! Placa sobre la que trabaja la aplicacion, compartida con las rutinas de interrupcion
+static Board_t board;
 
-/* === Public function implementation ========================================================= */
+//! Teclas de la placa indexadas por su identificador
+static digital_input_t keys[BOARD_KEYS_COUNT];
 
-int main(void) {
-    int divisor = 0;
-    uint8_t value[4] = {1, 2, 3, 4};
-    Board_t board = Board_Create();
+//! Reloj de tiempo real que avanza con las interrupciones del RTC o del SysTick
+static clock_bcd_t time_clock;
 
-    ScreenWriteBCD(board->screen, value, 4);
-    /*
-     DisplayFlashDigits(board->screen, 0, 4, 50);
+//! Alarmas del reloj, se manejan solamente desde el lazo principal
+static alarms_t alarms;
 
-     ScreenSetPoint(board->screen, 4, false);
-     ScreenSetPoint(board->screen, 3, false);
-     ScreenSetPoint(board->screen, 2, true);
-     ScreenSetPoint(board->screen, 1, false);
-     DisplayFlashPoints(board->screen, 1, 4, 50);
+//! Eventos que el SysTick le envia al lazo principal
+static event_queue_t events;
 
+//! Planificador de las tareas periodicas de la aplicacion
+static scheduler_t scheduler;
 
-     */
+//! Interfaz de usuario, recibe los eventos de las teclas, del reloj y de las alarmas
+static ui_t ui;
 
-    while (true) {
+//! Secuenciador de las melodias del zumbador
+static buzzer_t buzzer;
 
-        if (!DigitalInput_GetIsActive(board->accept)) {
-            DigitalOutput_Activate(board->blue_led);
-        } else {
-            DigitalOutput_Deactivate(board->blue_led);
-        }
-        if (!DigitalInput_GetIsActive(board->cancel)) {
-            DigitalOutput_Activate(board->red_led);
-        } else {
-            DigitalOutput_Deactivate(board->red_led);
+//! Almacenamiento de la configuracion en la EEPROM
+static storage_t storage;
+
+//! Indica si las teclas suenan al presionarlas
+static bool key_click = true;
+
+//! Error de frecuencia del SysTick que se guarda con la configuracion, en partes por mil millones
+static int32_t clock_correction;
+
+#if BOARD_PPS_INPUT
+//! Estimador del error de frecuencia del SysTick con los pulsos de referencia
+static pps_t reference;
+#endif
+
+//! Reconocedor de pulsaciones largas, repeticiones y acordes de las teclas
+static gestures_t gestures;
+
+//! Evento de la interfaz que genera la pulsacion de cada tecla
+static const ui_event_t KEY_EVENTS[BOARD_KEYS_COUNT] = {
+    [BOARD_KEY_SET_TIME] = UI_EVENT_SET_TIME,   [BOARD_KEY_SET_ALARM] = UI_EVENT_SET_ALARM,
+    [BOARD_KEY_DECREMENT] = UI_EVENT_DECREMENT, [BOARD_KEY_INCREMENT] = UI_EVENT_INCREMENT,
+    [BOARD_KEY_ACCEPT] = UI_EVENT_ACCEPT,       [BOARD_KEY_CANCEL] = UI_EVENT_CANCEL,
+};
+
+//! Gestos de cada tecla, las que entran a configurar requieren una pulsacion larga para evitar entradas accidentales
+static const uint8_t KEY_OPTIONS[BOARD_KEYS_COUNT] = {
+    [BOARD_KEY_SET_TIME] = GESTURE_OPTION_LONG_PRESS, [BOARD_KEY_SET_ALARM] = GESTURE_OPTION_LONG_PRESS,
+    [BOARD_KEY_DECREMENT] = GESTURE_OPTION_REPEAT,    [BOARD_KEY_INCREMENT] = GESTURE_OPTION_REPEAT,
+};
+
+//! Pitido corto de la alarma, una vez por segundo
+static const buzzer_note_t ALARM_BEEP[] = {{ALARM_TONE_HZ, 200}, {0, 800}};
+
+//! Pitido doble de la alarma, una vez por segundo
+static const buzzer_note_t ALARM_DOUBLE[] = {{ALARM_TONE_HZ, 100}, {0, 100}, {ALARM_TONE_HZ, 100}, {0, 700}};
+
+//! Pitido rapido y mas agudo de la alarma
+static const buzzer_note_t ALARM_URGENT[] = {{ALARM_URGENT_HZ, 100}, {0, 100}};
+
+//! Melodia de la alarma, se intensifica cada diez segundos hasta que se apaga o se pospone
+static const buzzer_pattern_t ALARM_MELODY[] = {
+    {ALARM_BEEP, 2, 10},
+    {ALARM_DOUBLE, 4, 10},
+    {ALARM_URGENT, 2, 0},
+};
+
+//! Sonido que confirma cada tecla
+static const buzzer_note_t CLICK_NOTE[] = {{CLICK_TONE_HZ, BUZZER_CLICK_MS}};
+
+//! Melodia de las teclas
+static const buzzer_pattern_t CLICK_MELODY[] = {{CLICK_NOTE, 1, 1}};
+
+#if !DIGITAL_INPUT_INTERRUPTS
+//! Ticks desde la ultima lectura del grupo de teclas
+static uint16_t keys_divisor;
+#endif
+
+//! Driver que conecta las alarmas con el zumbador de la placa
+static const struct alarm_driver_s alarm_driver = {
+    .AlarmTurnOn = AlarmTurnOn,
+    .AlarmTurnOff = AlarmTurnOff,
+};
+
+/* === Private function implementation ========================================================= */
+
+static void SysTickInit(uint32_t ticks_per_second) {
+    __disable_irq();
+    SystemCoreClockUpdate();
+    SysTick_Config(SystemCoreClock / ticks_per_second);
+    NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+    __enable_irq();
+}
+
+#if BOARD_RTC_TIMEBASE
+static void RtcInterruptInit(void) {
+    NVIC_SetPriority(RTC_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+    NVIC_EnableIRQ(RTC_IRQn);
+}
+#endif
+
+#if BOARD_PPS_INPUT
+static void ReferenceInterruptInit(void) {
+    NVIC_SetPriority(BOARD_REFERENCE_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+    NVIC_ClearPendingIRQ(BOARD_REFERENCE_IRQn);
+    NVIC_EnableIRQ(BOARD_REFERENCE_IRQn);
+}
+
+static void ReferenceUpdate(void) {
+    int32_t error;
+
+    if (PpsGetError(reference, &error)) {
+        ClockSetCorrection(time_clock, error);
+        // La EEPROM se reescribe solo cuando la medicion se aleja de lo guardado, no con cada estimacion
+        if ((error > clock_correction + PPS_SAVE_PPB) || (error < clock_correction - PPS_SAVE_PPB)) {
+            clock_correction = error;
         }
-        if (DigitalInput_GetIsActive(board->increment)) {
-            ScreenSetPoint(board->screen, 4, true);
-        } else {
-            ScreenSetPoint(board->screen, 4, false);
+    }
+}
+#endif
+
+static void SecondPostEvent(void) {
+    clock_time_t now;
+    event_t event = {.type = EVENT_SECOND_TICK};
+
+    ClockGetTime(time_clock, &now);
+    event.data = (now.time.seconds[0] == 0) && (now.time.seconds[1] == 0);
+    EventQueue_Push(events, &event);
+}
+
+static void AlarmTurnOn(uint8_t alarm) {
+    (void)alarm;
+    BuzzerPlay(buzzer, ALARM_MELODY, sizeof(ALARM_MELODY) / sizeof(ALARM_MELODY[0]), PRIORITY_ALARM);
+}
+
+static void AlarmTurnOff(void) {
+    BuzzerStop(buzzer);
+}
+
+static void Heartbeat(void * context) {
+    DigitalOutput_Toggle(context);
+}
+
+static void KeysPostEvents(void) {
+    event_t event = {0};
+
+    for (uint8_t key = 0; key < BOARD_KEYS_COUNT; key++) {
+        digital_state_t state;
+
+        // Una pulsacion corta puede dejar los dos flancos pendientes, se informan ambos en orden
+        while (true) {
+            PROFILE_START(PROFILE_DIGITAL_WAS_CHANGED);
+            state = Digital_WasChanged(keys[key]);
+            PROFILE_STOP(PROFILE_DIGITAL_WAS_CHANGED);
+            if (state == DIGITAL_INPUT_WAS_CHANGED) {
+                break;
+            }
+            event.type = (state == DIGITAL_INPUT_WAS_ACTIVATED) ? EVENT_KEY_PRESSED : EVENT_KEY_RELEASED;
+            event.source = key;
+            event.data = (uint16_t)SchedulerGetTime(scheduler);
+            EventQueue_Push(events, &event);
         }
-        if (DigitalInput_GetIsActive(board->decrement)) {
-            ScreenSetPoint(board->screen, 3, true);
-        } else {
-            ScreenSetPoint(board->screen, 3, false);
+    }
+}
+
+static void HandleGesture(gesture_t gesture, uint8_t key, void * context) {
+    (void)context;
+
+    if (BUZZER_CLICK_MS && key_click && (gesture != GESTURE_RELEASE)) {
+        // Mientras suena la alarma las teclas no se escuchan, su melodia tiene mas prioridad
+        BuzzerPlay(buzzer, CLICK_MELODY, 1, PRIORITY_CLICK);
+    }
+    switch (gesture) {
+    case GESTURE_PRESS:
+        if (!(KEY_OPTIONS[key] & GESTURE_OPTION_LONG_PRESS)) {
+            UiHandleEvent(ui, KEY_EVENTS[key]);
         }
-        if (DigitalInput_GetIsActive(board->set_time)) {
-            ScreenSetPoint(board->screen, 1, true);
-        } else {
-            ScreenSetPoint(board->screen, 1, false);
+        break;
+    case GESTURE_LONG_PRESS:
+    case GESTURE_REPEAT:
+        UiHandleEvent(ui, KEY_EVENTS[key]);
+        break;
+    case GESTURE_CHORD:
+        if (key == CHORD_DISPLAY) {
+            // Con la pantalla apagada el SysTick se puede estirar
+            ScreenSetBrightness(board->screen, ScreenGetBrightness(board->screen) ? 0 : SCREEN_BRIGHTNESS_MAX);
+        } else if (key == CHORD_CLICK) {
+            key_click = !key_click;
         }
+        break;
+    default:
+        break;
+    }
+}
 
-        if (DigitalInput_GetIsActive(board->set_alarm)) {
-            ScreenSetPoint(board->screen, 2, true);
-        } else {
-            ScreenSetPoint(board->screen, 2, false);
+static void SettingsSave(void) {
+    struct settings_s settings;
+
+    // Se borra la estructura completa para que el relleno no cuente como un cambio
+    memset(&settings, 0, sizeof(settings));
+    for (uint8_t index = 0; index < ALARM_MAX_COUNT; index++) {
+        AlarmsGet(alarms, index, &settings.alarms[index]);
+    }
+    settings.brightness = ScreenGetBrightness(board->screen);
+    settings.click = key_click;
+    settings.correction = clock_correction;
+    StorageSave(storage, &settings);
+}
+
+static void SettingsRestore(void) {
+    struct settings_s settings;
+
+    if (StorageLoad(storage, &settings) == 0) {
+        for (uint8_t index = 0; index < ALARM_MAX_COUNT; index++) {
+            AlarmsSet(alarms, index, &settings.alarms[index]);
         }
+        ScreenSetBrightness(board->screen, settings.brightness);
+        key_click = settings.click;
+        clock_correction = settings.correction;
+        ClockSetCorrection(time_clock, clock_correction);
+    }
+}
 
-        if (Digital_WasActivated(board->increment)) {
-            DigitalOutput_Activate(board->buzzer); // CORREGIR PONCHO
+static void AlarmDue(void) {
+    // La alarma enciende la pantalla aunque se haya apagado con el acorde
+    ScreenSetBrightness(board->screen, SCREEN_BRIGHTNESS_MAX);
+    UiHandleEvent(ui, UI_EVENT_ALARM);
+}
+
+static void HandleEvent(const event_t * event) {
+    switch (event->type) {
+    case EVENT_KEY_PRESSED:
+    case EVENT_KEY_RELEASED:
+        if (event->source < BOARD_KEYS_COUNT) {
+            GesturesKeyEvent(gestures, event->source, event->type == EVENT_KEY_PRESSED, event->data);
         }
-        if (Digital_WasActivated(board->decrement)) {
-            DigitalOutput_Deactivate(board->buzzer); // CORREGIR PONCHO
+        break;
+    case EVENT_SECOND_TICK:
+        UiHandleEvent(ui, UI_EVENT_SECOND);
+        if (event->data && AlarmsNewMinute(alarms)) {
+            AlarmDue();
         }
+        break;
+#if BOARD_PPS_INPUT
+    case EVENT_REFERENCE:
+        ReferenceUpdate();
+        break;
+#endif
+    default:
+        break;
+    }
+
+    // La configuracion solo cambia con las teclas, cuando suena una alarma que no se repite, al cambiar el minuto, o
+    // con una estimacion nueva del error de frecuencia
+    if ((event->type != EVENT_SECOND_TICK) || event->data) {
+        SettingsSave();
+    }
+}
 
-        divisor++;
-        if (divisor == 100) {
-            divisor = 0;
-            DigitalOutput_Toggle(board->green_led);
+static bool WorkPending(void) {
+    return !EventQueue_IsEmpty(events) || SchedulerPending(scheduler);
+}
+
+static uint32_t NextDeadline(void) {
+    uint32_t result;
+    uint32_t ticks;
+
+    if (!POWER_TICKLESS_IDLE || !ScreenServiceBlank()) {
+        return 1;
+    }
+#if DIGITAL_INPUT_INTERRUPTS
+    if (DigitalInput_DebounceActive()) {
+        return 1;
+    }
+    result = UINT32_MAX;
+#else
+    result = KEYS_SAMPLE_TICKS - keys_divisor;
+#endif
+    ticks = ClockTicksToNextSecond(time_clock);
+    if (ticks < result) {
+        result = ticks;
+    }
+    ticks = SchedulerTicksToNext(scheduler);
+    if (ticks < result) {
+        result = ticks;
+    }
+    return result;
+}
+
+/* === Public function implementation ========================================================= */
+
+void SysTick_Handler(void) {
+    bool edges = false;
+    uint16_t elapsed = PowerTickElapsed();
+
+    PROFILE_START(PROFILE_SCREEN_REFRESH);
+    ScreenServiceRefresh();
+    PROFILE_STOP(PROFILE_SCREEN_REFRESH);
+
+    // Con el SysTick estirado una interrupcion cubre varios ticks, el tiempo avanza igual que con una por tick
+    for (uint16_t tick = 0; tick < elapsed; tick++) {
+#if DIGITAL_INPUT_INTERRUPTS
+        edges |= DigitalInput_DebounceTick();
+#endif
+#if !BOARD_RTC_TIMEBASE
+        if (ClockNewTick(time_clock)) {
+            SecondPostEvent();
         }
-        ScreenRefresh(board->screen);
+#endif
+        SchedulerTick(scheduler);
+    }
+
+#if !DIGITAL_INPUT_INTERRUPTS
+    keys_divisor += elapsed;
+    if (keys_divisor >= KEYS_SAMPLE_TICKS) {
+        keys_divisor = 0;
+        edges = DigitalInputGroup_Update(board->keys);
+    }
+#endif
+    if (edges) {
+        KeysPostEvents();
+    }
+}
+
+#if BOARD_PPS_INPUT
+void BOARD_REFERENCE_IRQHandler(void) {
+    event_t event = {.type = EVENT_REFERENCE};
+
+    if (PpsCapture(reference, board->reference->Read())) {
+        EventQueue_Push(events, &event);
+    }
+}
+#endif
+
+#if BOARD_RTC_TIMEBASE
+void RTC_IRQHandler(void) {
+    // La hora cambia en el borde del segundo del cristal, la pantalla se actualiza al atender el evento
+    if (ClockNewSecond(time_clock)) {
+        SecondPostEvent();
+    }
+}
+#endif
+
+int main(void) {
+    clock_time_t now;
+    event_t event;
+    scheduler_task_t heartbeat;
+    alarm_config_t alarm = {
+        .time = {0, 6, 3, 0},
+        .weekdays = ALARM_EVERY_DAY,
+        .recurring = true,
+        .enabled = false,
+    };
+
+#if PROFILE_ENABLED
+    ProfileInit();
+#endif
+    PROFILE_START(PROFILE_BOARD_CREATE);
+    board = Board_Create();
+    PROFILE_STOP(PROFILE_BOARD_CREATE);
+    time_clock = ClockCreate(SYSTICK_RATE_HZ, board->rtc);
+    alarms = AlarmsCreate(&alarm_driver, ALARM_SNOOZE_MINUTES);
+    events = EventQueue_Create();
+    scheduler = SchedulerCreate(SYSTICK_RATE_HZ);
+#if BOARD_PPS_INPUT
+    reference = PpsCreate(board->reference->Rate());
+#endif
+    buzzer = BuzzerCreate(scheduler, board->tone);
+
+    keys[BOARD_KEY_SET_TIME] = board->set_time;
+    keys[BOARD_KEY_SET_ALARM] = board->set_alarm;
+    keys[BOARD_KEY_DECREMENT] = board->decrement;
+    keys[BOARD_KEY_INCREMENT] = board->increment;
+    keys[BOARD_KEY_ACCEPT] = board->accept;
+    keys[BOARD_KEY_CANCEL] = board->cancel;
+
+    ClockGetTime(time_clock, &now);
+    AlarmsSetTime(alarms, ClockGetWeekday(time_clock), now.bcd);
+    AlarmsSet(alarms, 0, &alarm);
+
+    storage = StorageCreate(board->eeprom, scheduler, SETTINGS_VERSION, sizeof(struct settings_s));
+    SettingsRestore();
+
+    ScreenServiceAdd(board->screen);
+    heartbeat = SchedulerAddTask(scheduler, Heartbeat, board->green_led);
+    SchedulerStart(scheduler, heartbeat, HEARTBEAT_PERIOD_MS, HEARTBEAT_PERIOD_MS);
 
-        for (int delay = 0; delay < 25000; delay++) {
-            __asm("NOP");
+    ui = UiCreate(time_clock, alarms, board->screen, scheduler);
+    gestures = GesturesCreate(scheduler, HandleGesture, NULL);
+    for (uint8_t key = 0; key < BOARD_KEYS_COUNT; key++) {
+        GesturesConfigure(gestures, key, KEY_OPTIONS[key]);
+    }
+    GesturesAddChord(gestures, (1 << BOARD_KEY_ACCEPT) | (1 << BOARD_KEY_CANCEL));
+    GesturesAddChord(gestures, (1 << BOARD_KEY_SET_TIME) | (1 << BOARD_KEY_SET_ALARM));
+    /*
+     DisplayFlashDigits(board->screen, 0, 4, 50);
+
+     ScreenSetPoint(board->screen, 4, false);
+     ScreenSetPoint(board->screen, 3, false);
+     ScreenSetPoint(board->screen, 2, true);
+     ScreenSetPoint(board->screen, 1, false);
+     DisplayFlashPoints(board->screen, 1, 4, 50);
+
+
+     */
+
+    SysTickInit(SYSTICK_RATE_HZ);
+#if BOARD_RTC_TIMEBASE
+    RtcInterruptInit();
+#endif
+#if BOARD_PPS_INPUT
+    ReferenceInterruptInit();
+#endif
+    PowerInit(SYSTICK_RATE_HZ);
+
+    while (true) {
+        // Toda la logica de la aplicacion responde a eventos y tareas, sin nada pendiente el procesador duerme
+        SchedulerRun(scheduler);
+        while (EventQueue_Pop(events, &event)) {
+            HandleEvent(&event);
         }
+        PowerIdle(WorkPending, NextDeadline);
     }
 }
 
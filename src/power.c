@@ -0,0 +1,132 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file power.c
+ ** @brief Codigo fuente del módulo de administracion de energia del lazo principal.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "power.h"
+#include "chip.h"
+#include "config.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Maximo valor del registro de recarga del SysTick, que es de 24 bits
+#define SYSTICK_MAX_RELOAD 0xFFFFFF
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Ciclos del procesador en un tick
+static uint32_t tick_cycles;
+
+//! Maxima cantidad de ticks por interrupcion
+static uint32_t max_stretch;
+
+//! Ticks del periodo del SysTick en curso, que empezo en la ultima interrupcion
+static uint32_t running = 1;
+
+//! Ticks del periodo cargado en el registro de recarga, que empieza al terminar el periodo en curso
+static uint32_t programmed = 1;
+
+//! Contadores de tiempo, los modifican la interrupcion (total y ticks) y el lazo principal (asleep y wakeups)
+static power_stats_t stats;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void PowerInit(uint32_t ticks_per_second) {
+    tick_cycles = SystemCoreClock / ticks_per_second;
+    max_stretch = SYSTICK_MAX_RELOAD / tick_cycles;
+    if (max_stretch > POWER_MAX_TICK_STRETCH) {
+        max_stretch = POWER_MAX_TICK_STRETCH;
+    }
+    if (max_stretch == 0) {
+        max_stretch = 1;
+    }
+}
+
+uint16_t PowerTickElapsed(void) {
+    uint32_t elapsed = running;
+
+    // El contador ya se recargo con el periodo programado, el siguiente vuelve a ser de un tick
+    running = programmed;
+    if (programmed != 1) {
+        programmed = 1;
+        SysTick->LOAD = tick_cycles - 1;
+    }
+    stats.total += (uint64_t)elapsed * tick_cycles;
+    stats.ticks++;
+    return elapsed;
+}
+
+void PowerIdle(power_pending_t pending, power_deadline_t deadline) {
+    uint32_t ticks;
+    uint32_t start;
+    uint32_t end;
+
+    __disable_irq();
+    if (!pending()) {
+        // Con una interrupcion pendiente del SysTick el contador ya se recargo y no se puede cambiar el periodo
+        if (deadline && !(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) {
+            ticks = deadline();
+            ticks = (ticks > running) ? ticks - running : 1;
+            if (ticks > max_stretch) {
+                ticks = max_stretch;
+            }
+            if (ticks != programmed) {
+                programmed = ticks;
+                SysTick->LOAD = ticks * tick_cycles - 1;
+            }
+        }
+
+        start = SysTick->VAL;
+        __WFI();
+        end = SysTick->VAL;
+
+        // Si desperto el SysTick el contador llego a cero y volvio a empezar desde el valor de recarga
+        if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+            stats.asleep += start + (SysTick->LOAD + 1 - end);
+        } else {
+            stats.asleep += start - end;
+        }
+        stats.wakeups++;
+    }
+    __enable_irq();
+}
+
+void PowerGetStats(power_stats_t * result) {
+    __disable_irq();
+    *result = stats;
+    __enable_irq();
+}
+
+/* === End of documentation ======================================================================================== */
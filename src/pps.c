@@ -0,0 +1,122 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file pps.c
+ ** @brief Codigo fuente del módulo que estima el error de frecuencia de la base de tiempo con pulsos de referencia.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "pps.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Partes por mil millones en la unidad
+#define PPS_PPB          1000000000LL
+
+//! Partes por millon en la unidad
+#define PPS_PPM          1000000ULL
+
+/* === Private data type declarations ============================================================================== */
+
+struct pps_s {
+    uint32_t rate;      // cuentas nominales entre dos pulsos
+    int32_t tolerance;  // desviacion maxima de un intervalo valido, en cuentas
+    uint32_t last;      // cuenta capturada con el pulso anterior
+    int64_t sum;        // suma de las desviaciones de los intervalos de la ventana en curso, en cuentas
+    uint8_t count;      // intervalos validos en la ventana en curso
+    int32_t error;      // error estimado, en partes por mil millones
+    bool started;       // indica si last tiene la cuenta de un pulso
+    bool estimated;     // indica si ya se completo una ventana
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toma el unico estimador
+POOL_DEFINE(PpsAllocate, struct pps_s, 1)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+pps_t PpsCreate(uint32_t rate) {
+    pps_t self = NULL;
+
+    if (rate >= PPS_PPM) {
+        self = PpsAllocate();
+    }
+    if (self != NULL) {
+        self->rate = rate;
+        self->tolerance = (int32_t)(((uint64_t)rate * PPS_TOLERANCE_PPM) / PPS_PPM);
+    }
+    return self;
+}
+
+bool PpsCapture(pps_t self, uint32_t capture) {
+    // La resta en enteros sin signo da el intervalo correcto aunque el contador haya dado la vuelta
+    int32_t deviation = (int32_t)(capture - self->last - self->rate);
+    int32_t estimate;
+
+    self->last = capture;
+    if (!self->started) {
+        self->started = true;
+        return false;
+    }
+    if ((deviation > self->tolerance) || (deviation < -self->tolerance)) {
+        // Un pulso perdido o uno falso no deben mover la estimacion, la ventana vuelve a empezar
+        self->sum = 0;
+        self->count = 0;
+        return false;
+    }
+    self->sum += deviation;
+    if (++self->count < PPS_WINDOW_PULSES) {
+        return false;
+    }
+
+    // El error es la desviacion media de un intervalo respecto de las cuentas nominales
+    estimate = (int32_t)((self->sum * PPS_PPB) / ((int64_t)self->count * self->rate));
+    self->sum = 0;
+    self->count = 0;
+    if (self->estimated) {
+        self->error += (estimate - self->error) / PPS_FILTER_WINDOWS;
+    } else {
+        self->error = estimate;
+        self->estimated = true;
+    }
+    return true;
+}
+
+bool PpsGetError(pps_t self, int32_t * error) {
+    if (self->estimated) {
+        *error = self->error;
+    }
+    return self->estimated;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,162 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file profile.c
+ ** @brief Codigo fuente del módulo de medicion de tiempos de ejecucion con el contador de ciclos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "profile.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#if !defined(__arm__)
+#include <time.h>
+#endif
+
+#if PROFILE_ENABLED
+
+/* === Macros definitions ========================================================================================== */
+
+//! Longitud maxima de una linea del volcado de estadisticas
+#define PROFILE_LINE_SIZE 96
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula la barra del histograma que corresponde a una duracion.
+ *
+ * @param cycles Duracion medida.
+ * @return uint8_t Indice de la barra, la ultima acumula todas las duraciones mayores.
+ */
+static uint8_t ProfileBucket(uint32_t cycles);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estadisticas de cada sitio de medicion
+static profile_stats_t sites[PROFILE_SITES];
+
+//! Nombres de los sitios de medicion para el volcado, en el mismo orden que profile_site_t
+static const char * const SITE_NAMES[PROFILE_SITES] = {
+    "ScreenRefresh",
+    "Digital_WasChanged",
+    "Board_Create",
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t ProfileBucket(uint32_t cycles) {
+    // La barra es la cantidad de bits significativos de la duracion, una sola instruccion CLZ en el procesador
+    uint8_t bucket = (cycles == 0) ? 0 : (uint8_t)(32 - __builtin_clz(cycles));
+
+    if (bucket >= PROFILE_HISTOGRAM_BUCKETS) {
+        bucket = PROFILE_HISTOGRAM_BUCKETS - 1;
+    }
+    return bucket;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void ProfileInit(void) {
+#if defined(__arm__)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    memset(sites, 0, sizeof(sites));
+    for (uint8_t site = 0; site < PROFILE_SITES; site++) {
+        sites[site].min = UINT32_MAX;
+    }
+}
+
+#if !defined(__arm__)
+uint32_t ProfileCycles(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec);
+}
+#endif
+
+void ProfileRecord(profile_site_t site, uint32_t cycles) {
+    profile_stats_t * stats;
+
+    if (site < PROFILE_SITES) {
+        stats = &sites[site];
+        stats->count++;
+        stats->total += cycles;
+        if (cycles < stats->min) {
+            stats->min = cycles;
+        }
+        if (cycles > stats->max) {
+            stats->max = cycles;
+        }
+        stats->histogram[ProfileBucket(cycles)]++;
+    }
+}
+
+int ProfileGet(profile_site_t site, profile_stats_t * stats) {
+    int result = -1;
+
+    if (site < PROFILE_SITES) {
+        *stats = sites[site];
+        result = 0;
+    }
+    return result;
+}
+
+void ProfileDump(profile_output_t output) {
+    char line[PROFILE_LINE_SIZE];
+    profile_stats_t stats;
+
+    for (uint8_t site = 0; site < PROFILE_SITES; site++) {
+        ProfileGet(site, &stats);
+        if (stats.count == 0) {
+            continue;
+        }
+        snprintf(line, sizeof(line), "%s: n=%lu min=%lu max=%lu mean=%lu", SITE_NAMES[site],
+                 (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.max,
+                 (unsigned long)(stats.total / stats.count));
+        output(line);
+
+        for (uint8_t bucket = 0; bucket < PROFILE_HISTOGRAM_BUCKETS; bucket++) {
+            if (stats.histogram[bucket] == 0) {
+                continue;
+            }
+            if (bucket == PROFILE_HISTOGRAM_BUCKETS - 1) {
+                snprintf(line, sizeof(line), "  >=2^%u: %lu", bucket - 1, (unsigned long)stats.histogram[bucket]);
+            } else {
+                snprintf(line, sizeof(line), "  <2^%u: %lu", bucket, (unsigned long)stats.histogram[bucket]);
+            }
+            output(line);
+        }
+    }
+}
+
+#endif /* PROFILE_ENABLED */
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,299 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file scheduler.c
+ ** @brief Codigo fuente del módulo planificador de tareas periodicas y de disparo unico.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "scheduler.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#if (SCHEDULER_WHEEL_SLOTS & (SCHEDULER_WHEEL_SLOTS - 1)) || (SCHEDULER_WHEEL_SLOTS == 0)
+#error "SCHEDULER_WHEEL_SLOTS debe ser una potencia de dos"
+#endif
+
+//! Mascara que convierte un numero de tick en una ranura de la rueda
+#define SCHEDULER_WHEEL_MASK (SCHEDULER_WHEEL_SLOTS - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+struct scheduler_list_s {
+    struct scheduler_task_s * head; // primera tarea de la lista, la primera en ejecutarse
+    struct scheduler_task_s * tail; // ultima tarea de la lista, donde se agregan las nuevas
+};
+
+struct scheduler_task_s {
+    struct scheduler_task_s * next;   // siguiente tarea de la misma lista
+    struct scheduler_task_s * prev;   // tarea anterior de la misma lista, NULL si es la primera
+    struct scheduler_list_s * list;   // lista en la que esta la tarea, NULL si esta detenida
+    scheduler_callback_t callback;    // funcion a ejecutar al vencer la tarea
+    void * context;                   // parametro de la funcion
+    uint32_t period;                  // periodo en ticks, 0 para una tarea de disparo unico
+    uint32_t rounds;                  // vueltas completas de la rueda que faltan para el vencimiento
+    bool allocated;                   // indica si la tarea fue entregada por SchedulerAddTask
+};
+
+struct scheduler_s {
+    struct scheduler_list_s wheel[SCHEDULER_WHEEL_SLOTS]; // tareas activas agrupadas por ranura de vencimiento
+    struct scheduler_list_s ready;                        // tareas vencidas pendientes de ejecucion
+    struct scheduler_task_s tasks[SCHEDULER_MAX_TASKS];   // tareas disponibles
+    uint16_t ticks_per_second;                            // frecuencia de los ticks
+    uint16_t tick_milliseconds;                           // milisegundos enteros que dura un tick
+    uint16_t tick_remainder;                              // resto de un tick, en 1/ticks_per_second de milisegundo
+    uint16_t fraction;                                    // resto acumulado, en 1/ticks_per_second de milisegundo
+    volatile uint32_t ticks;                              // ticks registrados, solo lo modifica la interrupcion
+    volatile uint32_t milliseconds;                       // tiempo registrado, solo lo modifica la interrupcion
+    uint32_t now;                                         // ultimo tick procesado por el lazo principal
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte un tiempo en milisegundos a ticks, redondeando hacia arriba.
+ *
+ * @param self Puntero al planificador.
+ * @param milliseconds Tiempo a convertir.
+ * @return uint32_t Cantidad de ticks, como minimo uno.
+ */
+static uint32_t SchedulerTicks(scheduler_t self, uint32_t milliseconds);
+
+/**
+ * @brief Agrega una tarea al final de una lista, para que las tareas que vencen juntas se ejecuten en el orden en
+ * que se programaron.
+ *
+ * @param task Puntero a la tarea, que no debe estar en ninguna lista.
+ * @param list Lista a la que se agrega.
+ */
+static void TaskLink(scheduler_task_t task, struct scheduler_list_s * list);
+
+/**
+ * @brief Quita una tarea de la lista en la que esta.
+ *
+ * @param task Puntero a la tarea.
+ */
+static void TaskUnlink(scheduler_task_t task);
+
+/**
+ * @brief Ubica una tarea en la ranura de la rueda donde vence.
+ *
+ * @param self Puntero al planificador.
+ * @param task Puntero a la tarea, que no debe estar en ninguna lista.
+ * @param delay Ticks que faltan para el vencimiento, como minimo uno.
+ */
+static void TaskSchedule(scheduler_t self, scheduler_task_t task, uint32_t delay);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toma el unico planificador
+POOL_DEFINE(SchedulerAllocate, struct scheduler_s, 1)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t SchedulerTicks(scheduler_t self, uint32_t milliseconds) {
+    uint64_t ticks = ((uint64_t)milliseconds * self->ticks_per_second + 999) / 1000;
+
+    if (ticks == 0) {
+        ticks = 1;
+    } else if (ticks > UINT32_MAX) {
+        ticks = UINT32_MAX;
+    }
+    return (uint32_t)ticks;
+}
+
+static void TaskLink(scheduler_task_t task, struct scheduler_list_s * list) {
+    task->next = NULL;
+    task->prev = list->tail;
+    if (task->prev) {
+        task->prev->next = task;
+    } else {
+        list->head = task;
+    }
+    task->list = list;
+    list->tail = task;
+}
+
+static void TaskUnlink(scheduler_task_t task) {
+    if (task->prev) {
+        task->prev->next = task->next;
+    } else {
+        task->list->head = task->next;
+    }
+    if (task->next) {
+        task->next->prev = task->prev;
+    } else {
+        task->list->tail = task->prev;
+    }
+    task->next = NULL;
+    task->prev = NULL;
+    task->list = NULL;
+}
+
+static void TaskSchedule(scheduler_t self, scheduler_task_t task, uint32_t delay) {
+    // La ranura se visita por primera vez dentro de la vuelta actual y luego una vez por cada vuelta completa
+    task->rounds = (delay - 1) / SCHEDULER_WHEEL_SLOTS;
+    TaskLink(task, &self->wheel[(self->now + delay) & SCHEDULER_WHEEL_MASK]);
+}
+
+/* === Public function implementation ============================================================================== */
+
+scheduler_t SchedulerCreate(uint16_t ticks_per_second) {
+    scheduler_t self = NULL;
+
+    if (ticks_per_second != 0) {
+        self = SchedulerAllocate();
+    }
+    if (self != NULL) {
+        self->ticks_per_second = ticks_per_second;
+        // Las divisiones se hacen una sola vez, el tick solo suma la parte entera y acumula la fraccion
+        self->tick_milliseconds = 1000 / ticks_per_second;
+        self->tick_remainder = 1000 % ticks_per_second;
+    }
+    return self;
+}
+
+scheduler_task_t SchedulerAddTask(scheduler_t self, scheduler_callback_t callback, void * context) {
+    scheduler_task_t task = NULL;
+
+    if ((self != NULL) && (callback != NULL)) {
+        for (uint8_t index = 0; index < SCHEDULER_MAX_TASKS; index++) {
+            if (!self->tasks[index].allocated) {
+                task = &self->tasks[index];
+                task->allocated = true;
+                task->callback = callback;
+                task->context = context;
+                break;
+            }
+        }
+    }
+    return task;
+}
+
+int SchedulerStart(scheduler_t self, scheduler_task_t task, uint32_t delay, uint32_t period) {
+    int result = -1;
+
+    if ((self != NULL) && (task != NULL)) {
+        if (task->list) {
+            TaskUnlink(task);
+        }
+        task->period = (period != 0) ? SchedulerTicks(self, period) : 0;
+        TaskSchedule(self, task, SchedulerTicks(self, delay));
+        result = 0;
+    }
+    return result;
+}
+
+int SchedulerStop(scheduler_t self, scheduler_task_t task) {
+    int result = -1;
+
+    if ((self != NULL) && (task != NULL)) {
+        if (task->list) {
+            TaskUnlink(task);
+        }
+        result = 0;
+    }
+    return result;
+}
+
+bool SchedulerIsActive(scheduler_task_t task) {
+    return (task != NULL) && (task->list != NULL);
+}
+
+bool SchedulerPending(scheduler_t self) {
+    return self->now != self->ticks;
+}
+
+uint32_t SchedulerTicksToNext(scheduler_t self) {
+    uint32_t result = UINT32_MAX;
+
+    for (uint32_t delay = 1; delay <= SCHEDULER_WHEEL_SLOTS; delay++) {
+        for (scheduler_task_t task = self->wheel[(self->now + delay) & SCHEDULER_WHEEL_MASK].head; task;
+             task = task->next) {
+            uint32_t due = delay + task->rounds * SCHEDULER_WHEEL_SLOTS;
+
+            if (due < result) {
+                result = due;
+            }
+        }
+        // Una tarea sin vueltas pendientes en esta ranura vence antes que cualquiera de las ranuras siguientes
+        if (result <= delay) {
+            break;
+        }
+    }
+    return result;
+}
+
+uint32_t SchedulerGetTime(scheduler_t self) {
+    return self->milliseconds;
+}
+
+void SchedulerTick(scheduler_t self) {
+    uint32_t milliseconds = self->milliseconds + self->tick_milliseconds;
+
+    // La fraccion es siempre menor que ticks_per_second, asi que en cada tick se completa a lo sumo un milisegundo
+    self->fraction += self->tick_remainder;
+    if (self->fraction >= self->ticks_per_second) {
+        self->fraction -= self->ticks_per_second;
+        milliseconds++;
+    }
+    self->milliseconds = milliseconds;
+    self->ticks++;
+}
+
+void SchedulerRun(scheduler_t self) {
+    scheduler_task_t task;
+    scheduler_task_t next;
+
+    while (self->now != self->ticks) {
+        self->now++;
+
+        // Solo se recorre la ranura del tick actual, las tareas de vueltas posteriores descuentan una vuelta
+        for (task = self->wheel[self->now & SCHEDULER_WHEEL_MASK].head; task != NULL; task = next) {
+            next = task->next;
+            if (task->rounds) {
+                task->rounds--;
+            } else {
+                TaskUnlink(task);
+                TaskLink(task, &self->ready);
+            }
+        }
+
+        // Las tareas periodicas se reprograman antes de ejecutarse para que la funcion pueda detenerlas
+        while (self->ready.head != NULL) {
+            task = self->ready.head;
+            TaskUnlink(task);
+            if (task->period) {
+                TaskSchedule(self, task, task->period);
+            }
+            task->callback(task->context);
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
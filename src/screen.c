@@ -28,9 +28,10 @@ SPDX-License-Identifier: MIT
 
 #include "screen.h"
 #include "poncho.h"
+#include "config.h"
+#include "pool.h"
 #include <stddef.h>
 #include <stdint.h>
-#include <stdlib.h>
 #include <string.h>
 
 /* === Macros definitions ========================================================================================== */
@@ -39,26 +40,124 @@ SPDX-License-Identifier: MIT
 #define SCREEN_MAX_DIGITS 8
 #endif
 
+//! Primer caracter de la tabla de la fuente
+#define FONT_FIRST ' '
+
+//! Cantidad de caracteres de la tabla de la fuente
+#define FONT_SIZE  (sizeof(FONT) / sizeof(FONT[0]))
+
 /* === Private data type declarations ============================================================================== */
 
+//! Cuadro precompuesto con todo lo que necesita el refresco de la pantalla
+struct screen_frame_s {
+    uint8_t images[2][SCREEN_MAX_DIGITS]; // segmentos de cada digito, con el parpadeo encendido y apagado
+    uint8_t levels[SCREEN_MAX_DIGITS];    // brillo final de cada digito
+    uint16_t flashing_frequency;          // periodo de parpadeo en barridos completos, 0 si no hay parpadeo
+    uint16_t flashing_half;               // cantidad de barridos del periodo en que se apagan los digitos
+    uint8_t sequence;                     // numero de publicacion del cuadro
+};
+
 struct screen_s {
-    uint8_t digits;                   // numero de digitos de la pantalla
-    uint8_t value[SCREEN_MAX_DIGITS]; // valores a mostrar en la pantalla
-    uint8_t current_digit;            // digito actual que se esta mostrando
-    screen_driver_t driver;           // puntero a la estructura de driver de pantalla
-    uint8_t flashing_from;            // rango de digitos a parpadear
-    uint8_t flashing_to;              // rango de digitos a parpadear
-    uint8_t flashing_count;           // contador de parpadeo
-    uint16_t flashing_frequency;      // frecuencia de parpadeo en milisegundos
-    uint8_t flashing_point_from;    // punto decimal del primer digito a parpadear
-    uint8_t flashing_point_to;  // punto decimal del ultimo digito a parpadear
-    //bool flashing_point_enable; // habilita el punto decimal en los digitos que parpadean
+    uint8_t digits;                       // numero de digitos de la pantalla
+    uint8_t value[SCREEN_MAX_DIGITS];     // valores a mostrar en la pantalla, sin los puntos decimales
+    uint8_t points;                       // mascara de puntos decimales encendidos
+    uint8_t current_digit;                // digito actual que se esta mostrando
+    screen_driver_t driver;               // puntero a la estructura de driver de pantalla
+    uint8_t flashing_from;                // rango de digitos a parpadear
+    uint8_t flashing_to;                  // rango de digitos a parpadear
+    uint16_t flashing_count;              // contador de parpadeo
+    uint16_t flashing_frequency;          // frecuencia de parpadeo en milisegundos
+    uint8_t flashing_point_from;          // punto decimal del primer digito a parpadear
+    uint8_t flashing_point_to;            // punto decimal del ultimo digito a parpadear
+    uint8_t brightness;                   // brillo de toda la pantalla
+    uint8_t digit_levels[SCREEN_MAX_DIGITS];  // brillo relativo de cada digito
+    uint8_t phase;                        // cuadro que se muestra en el barrido actual, 1 con el parpadeo apagado
+    struct screen_frame_s frames[2];      // cuadros de la pantalla, uno publicado y otro en composicion
+    volatile uint8_t front;               // indice del cuadro publicado que usa el refresco
+    uint8_t sequence;                     // numero de la ultima publicacion
+    uint8_t shown_sequence;               // publicacion entregada al driver cuando multiplexa por hardware
+    uint8_t shown_phase;                  // fase de parpadeo entregada al driver cuando multiplexa por hardware
+    uint8_t marquee[SCREEN_MARQUEE_SIZE]; // segmentos del texto que se desplaza por la pantalla
+    uint8_t marquee_length;               // cantidad de caracteres del texto desplazado, 0 si no hay ninguno
+    uint8_t marquee_position;             // proximo caracter del texto que entra por la derecha
+};
 
+//! Servicio que refresca todas las pantallas registradas desde una unica interrupcion periodica
+struct screen_service_s {
+    screen_t screens[SCREEN_SERVICE_SCREENS];                  // pantallas registradas
+    uint8_t count;                                             // cantidad de pantallas registradas
+    uint8_t slots[SCREEN_SERVICE_SCREENS * SCREEN_MAX_DIGITS]; // pantalla que ocupa cada turno del barrido
+    uint8_t slots_count;                                       // cantidad de turnos del barrido, uno por digito
+    uint8_t slot;                                              // proximo turno del barrido
+    screen_t lit;                                              // pantalla con un digito encendido, o NULL
 };
 
 /* === Private function declarations =============================================================================== */
 
-static const uint8_t IMAGES[10] = {
+/**
+ * @brief Compone un cuadro nuevo a partir del estado de la pantalla y lo publica.
+ *
+ * El cuadro se arma en el buffer que no usa el refresco y se publica con una unica escritura del indice, de manera
+ * que el refresco nunca ve un cuadro a medio escribir.
+ *
+ * @param self Puntero al objeto pantalla.
+ */
+static void ScreenPublish(screen_t self);
+
+/**
+ * @brief Convierte un texto en los segmentos de cada digito.
+ *
+ * Un punto o una coma despues de un caracter enciende el punto decimal de ese caracter en lugar de ocupar un digito.
+ *
+ * @param text Texto terminado en cero.
+ * @param images Vector donde se guardan los segmentos.
+ * @param size Cantidad maxima de digitos que se guardan en el vector.
+ * @return uint16_t Cantidad de digitos que ocupa el texto completo, puede ser mayor que size.
+ */
+static uint16_t ScreenRender(const char * text, uint8_t images[], uint8_t size);
+
+/**
+ * @brief Pasa al digito siguiente de la pantalla y actualiza la fase del parpadeo al completar un barrido.
+ *
+ * @param self Puntero al objeto pantalla.
+ * @param frame Cuadro publicado que se esta mostrando.
+ */
+static void ScreenNextDigit(screen_t self, const struct screen_frame_s * frame);
+
+/**
+ * @brief Escribe los segmentos del digito actual y lo enciende con su brillo, si no esta apagado.
+ *
+ * @param self Puntero al objeto pantalla, que debe usar un driver sin FrameUpdate.
+ * @param frame Cuadro publicado que se esta mostrando.
+ */
+static void ScreenShowDigit(screen_t self, const struct screen_frame_s * frame);
+
+/**
+ * @brief Reparte los turnos del barrido entre las pantallas registradas, intercalandolas.
+ *
+ * Cada pantalla recibe un turno por digito, y los turnos de cada una quedan distribuidos lo mas parejo posible a lo
+ * largo del barrido para que todos los digitos se refresquen con la misma frecuencia.
+ */
+static void ScreenServiceSchedule(void);
+
+//! Segmentos de cada caracter ASCII desde FONT_FIRST, los que no se pueden mostrar de forma legible quedan apagados
+static const uint8_t FONT[] = {
+    0,                                                                                 // espacio
+    0,                                                                                 // !
+    SEGMENT_B | SEGMENT_F,                                                             // "
+    0,                                                                                 // #
+    0,                                                                                 // $
+    0,                                                                                 // %
+    0,                                                                                 // &
+    SEGMENT_F,                                                                         // '
+    SEGMENT_A | SEGMENT_D | SEGMENT_F,                                                 // (
+    SEGMENT_A | SEGMENT_B | SEGMENT_D,                                                 // )
+    0,                                                                                 // *
+    0,                                                                                 // +
+    SEGMENT_P,                                                                         // ,
+    SEGMENT_G,                                                                         // -
+    SEGMENT_P,                                                                         // .
+    SEGMENT_B | SEGMENT_E | SEGMENT_G,                                                 // /
     SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             // 0
     SEGMENT_B | SEGMENT_C,                                                             // 1
     SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // 2
@@ -68,20 +167,207 @@ static const uint8_t IMAGES[10] = {
     SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             // 6
     SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 // 7
     SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, // 8
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G              // 9
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,             // 9
+    0,                                                                                 // :
+    0,                                                                                 // ;
+    0,                                                                                 // <
+    SEGMENT_D | SEGMENT_G,                                                             // =
+    0,                                                                                 // >
+    SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_G,                                     // ?
+    0,                                                                                 // @
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G,             // A
+    SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         // B
+    SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F,                                     // C
+    SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // D
+    SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         // E
+    SEGMENT_A | SEGMENT_E | SEGMENT_F | SEGMENT_G,                                     // F
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,                         // G
+    SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         // H
+    SEGMENT_E | SEGMENT_F,                                                             // I
+    SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E,                                     // J
+    0,                                                                                 // K
+    SEGMENT_D | SEGMENT_E | SEGMENT_F,                                                 // L
+    0,                                                                                 // M
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F,                         // N
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             // O
+    SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         // P
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // Q
+    SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_F,                                     // R
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // S
+    SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                                     // T
+    SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,                         // U
+    0,                                                                                 // V
+    0,                                                                                 // W
+    0,                                                                                 // X
+    SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // Y
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // Z
+    SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F,                                     // [
+    0,                                                                                 // barra invertida
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D,                                     // ]
+    SEGMENT_A | SEGMENT_B | SEGMENT_F,                                                 // ^
+    SEGMENT_D,                                                                         // _
+    SEGMENT_B,                                                                         // `
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G,             // a
+    SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         // b
+    SEGMENT_D | SEGMENT_E | SEGMENT_G,                                                 // c
+    SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // d
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             // e
+    SEGMENT_A | SEGMENT_E | SEGMENT_F | SEGMENT_G,                                     // f
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,             // g
+    SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G,                                     // h
+    SEGMENT_E,                                                                         // i
+    SEGMENT_C | SEGMENT_D,                                                             // j
+    0,                                                                                 // k
+    SEGMENT_E | SEGMENT_F,                                                             // l
+    0,                                                                                 // m
+    SEGMENT_C | SEGMENT_E | SEGMENT_G,                                                 // n
+    SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G,                                     // o
+    SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         // p
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                         // q
+    SEGMENT_E | SEGMENT_G,                                                             // r
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // s
+    SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                                     // t
+    SEGMENT_C | SEGMENT_D | SEGMENT_E,                                                 // u
+    0,                                                                                 // v
+    0,                                                                                 // w
+    0,                                                                                 // x
+    SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // y
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // z
+    0,                                                                                 // {
+    0,                                                                                 // |
+    0,                                                                                 // }
+    0,                                                                                 // ~
+    0,                                                                                 // DEL
 };
 
 /* === Private variable definitions ================================================================================ */
 
+//! Memoria de la que se toman las pantallas
+POOL_DEFINE(ScreenAllocate, struct screen_s, SCREEN_INSTANCES)
+
+//! Unica instancia del servicio de refresco
+static struct screen_service_s service;
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
-/* === Public function implementation ============================================================================== */
+static void ScreenPublish(screen_t self) {
+    struct screen_frame_s * back = &self->frames[self->front ^ 1];
+
+    for (uint8_t digit = 0; digit < self->digits; digit++) {
+        uint8_t segments = self->value[digit];
+
+        // El brillo final se calcula al publicar para que el refresco no tenga que multiplicar en cada turno
+        back->levels[digit] = (self->brightness * self->digit_levels[digit] + SCREEN_BRIGHTNESS_MAX / 2) /
+                              SCREEN_BRIGHTNESS_MAX;
+
+        if (self->points & (1 << digit)) {
+            segments |= SEGMENT_P;
+        }
+        // Un driver con FrameUpdate no recibe los niveles, un digito sin brillo le llega apagado
+        if (back->levels[digit] == 0) {
+            segments = 0;
+        }
+        back->images[0][digit] = segments;
+
+        if ((digit >= self->flashing_from) && (digit <= self->flashing_to)) {
+            segments = 0;
+        }
+        if ((digit >= self->flashing_point_from) && (digit <= self->flashing_point_to)) {
+            segments &= ~SEGMENT_P;
+        }
+        back->images[1][digit] = segments;
+    }
+    back->flashing_frequency = self->flashing_frequency;
+    back->flashing_half = self->flashing_frequency / 2;
+    back->sequence = ++self->sequence;
+
+    __sync_synchronize();
+    self->front ^= 1;
+}
+
+static uint16_t ScreenRender(const char * text, uint8_t images[], uint8_t size) {
+    uint16_t count = 0;
+    uint8_t segments;
+
+    for (; *text != '\0'; text++) {
+        segments = ScreenGlyph(*text);
+        if ((segments == SEGMENT_P) && (count != 0) && (count <= size) && !(images[count - 1] & SEGMENT_P)) {
+            images[count - 1] |= SEGMENT_P;
+        } else {
+            if (count < size) {
+                images[count] = segments;
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+static void ScreenNextDigit(screen_t self, const struct screen_frame_s * frame) {
+    self->current_digit++;
+    if (self->current_digit >= self->digits) {
+        self->current_digit = 0;
 
+        // La fase del parpadeo solo cambia entre barridos completos de la pantalla
+        if (frame->flashing_frequency != 0) {
+            self->flashing_count++;
+            if (self->flashing_count >= frame->flashing_frequency) {
+                self->flashing_count = 0;
+            }
+            self->phase = (self->flashing_count < frame->flashing_half);
+        } else {
+            self->phase = 0;
+        }
+    }
+}
+
+static void ScreenShowDigit(screen_t self, const struct screen_frame_s * frame) {
+    uint8_t level = frame->levels[self->current_digit];
+
+    if (level != 0) {
+        self->driver->SegmentsUpdate(frame->images[self->phase][self->current_digit]);
+        self->driver->DigitsTurnOn(self->current_digit);
+        if (self->driver->DigitBrightness != NULL) {
+            self->driver->DigitBrightness(self->current_digit, level);
+        }
+    }
+}
+
+static void ScreenServiceSchedule(void) {
+    int16_t credits[SCREEN_SERVICE_SCREENS] = {0};
+    uint8_t total = 0;
+    uint8_t best;
+
+    for (uint8_t index = 0; index < service.count; index++) {
+        if (service.screens[index]->driver->FrameUpdate == NULL) {
+            total += service.screens[index]->digits;
+        }
+    }
+
+    // Cada turno lo toma la pantalla mas atrasada respecto de su parte del barrido, proporcional a sus digitos
+    for (uint8_t slot = 0; slot < total; slot++) {
+        best = SCREEN_SERVICE_SCREENS;
+        for (uint8_t index = 0; index < service.count; index++) {
+            if (service.screens[index]->driver->FrameUpdate == NULL) {
+                credits[index] += service.screens[index]->digits;
+                if ((best == SCREEN_SERVICE_SCREENS) || (credits[index] > credits[best])) {
+                    best = index;
+                }
+            }
+        }
+        credits[best] -= total;
+        service.slots[slot] = best;
+    }
+    service.slots_count = total;
+    service.slot = 0;
+}
+
+/* === Public function implementation ============================================================================== */
 
 screen_t ScreenCreate(uint8_t digits, screen_driver_t driver) {
-    screen_t self = malloc(sizeof(struct screen_s));
+    screen_t self = ScreenAllocate();
 
     if (digits > SCREEN_MAX_DIGITS) {
         digits = SCREEN_MAX_DIGITS;
@@ -89,62 +375,152 @@ screen_t ScreenCreate(uint8_t digits, screen_driver_t driver) {
     if (self != NULL) {
         self->digits = digits;
         self->driver = driver;
-        self->current_digit = 0;
-        self->flashing_count = 0;
-        self->flashing_frequency = 0;
-        //self->flashing_point_enable = false;
-
+        self->flashing_from = SCREEN_MAX_DIGITS;
+        self->flashing_point_from = SCREEN_MAX_DIGITS;
+        self->brightness = SCREEN_BRIGHTNESS_MAX;
+        memset(self->digit_levels, SCREEN_BRIGHTNESS_MAX, sizeof(self->digit_levels));
+        ScreenPublish(self);
+        self->shown_sequence = self->sequence - 1;
     }
     return self;
 }
 
-
 void ScreenWriteBCD(screen_t screen, uint8_t value[], uint8_t size) {
     memset(screen->value, 0, sizeof(screen->value));
     if (size > screen->digits) {
         size = screen->digits;
     }
     for (uint8_t i = 0; i < size; i++) {
-        screen->value[i] = IMAGES[value[i]];
+        screen->value[i] = FONT['0' - FONT_FIRST + value[i]];
     }
+    screen->marquee_length = 0;
+    ScreenPublish(screen);
 }
 
+uint8_t ScreenGlyph(char symbol) {
+    uint8_t index = (uint8_t)(symbol - FONT_FIRST);
 
-void ScreenRefresh(screen_t self) {
-    uint8_t segments;
+    return (index < FONT_SIZE) ? FONT[index] : 0;
+}
 
-    self->driver->DigitsTurnOff();
-    self->current_digit = (self->current_digit + 1) % self->digits;
+int ScreenWriteString(screen_t self, const char * text) {
+    int result = -1;
 
-    segments = self->value[self->current_digit];
+    if ((self != NULL) && (text != NULL)) {
+        memset(self->value, 0, sizeof(self->value));
+        ScreenRender(text, self->value, self->digits);
+        self->marquee_length = 0;
+        ScreenPublish(self);
+        result = 0;
+    }
+    return result;
+}
 
-    // Si hay parpadeo activo para dígitos o puntos
-    if (self->flashing_frequency != 0) {
-        if (self->current_digit == 0) {
-            self->flashing_count = (self->flashing_count + 1) % (self->flashing_frequency);
+int ScreenScrollString(screen_t self, const char * text) {
+    int result = -1;
+
+    if ((self != NULL) && (text != NULL)) {
+        // El texto se convierte una sola vez, cada paso solo desplaza la pantalla y agrega un caracter ya convertido.
+        // Se convierte aparte para que un texto rechazado no altere el que se esta desplazando
+        uint8_t images[SCREEN_MARQUEE_SIZE];
+        uint16_t length = ScreenRender(text, images, SCREEN_MARQUEE_SIZE);
+
+        if ((length != 0) && (length <= SCREEN_MARQUEE_SIZE)) {
+            memcpy(self->marquee, images, length);
+            memset(self->value, 0, sizeof(self->value));
+            self->marquee_length = length;
+            self->marquee_position = 0;
+            ScreenPublish(self);
+            result = 0;
         }
+    }
+    return result;
+}
 
-        // Primera mitad del ciclo: parpadeo activo
-        if (self->flashing_count < (self->flashing_frequency / 2)) {
+bool ScreenScrollStep(screen_t self) {
+    bool wrapped = false;
 
-            // Apaga segmentos si el dígito está en rango
-            if ((self->current_digit >= self->flashing_from) &&
-                (self->current_digit <= self->flashing_to)) {
-                segments = 0;
-            }
+    if ((self != NULL) && (self->marquee_length != 0)) {
+        memmove(self->value, self->value + 1, self->digits - 1);
+        self->value[self->digits - 1] =
+            (self->marquee_position < self->marquee_length) ? self->marquee[self->marquee_position] : 0;
 
-            // Apaga sólo el punto decimal si está habilitado y en rango
-            if ((self->current_digit >= self->flashing_point_from) &&
-                (self->current_digit <= self->flashing_point_to)) {
-                segments &= ~SEGMENT_P;
-            }
+        // Despues del texto entran tantos digitos apagados como tiene la pantalla, asi el texto sale completo
+        self->marquee_position++;
+        if (self->marquee_position >= self->marquee_length + self->digits) {
+            self->marquee_position = 0;
+            wrapped = true;
         }
+        ScreenPublish(self);
+    }
+    return wrapped;
+}
+
+void ScreenRefresh(screen_t self) {
+    const struct screen_frame_s * frame = &self->frames[self->front];
+    bool hardware = (self->driver->FrameUpdate != NULL);
+
+    if (!hardware) {
+        self->driver->DigitsTurnOff();
+    }
+    ScreenNextDigit(self, frame);
+
+    if (!hardware) {
+        ScreenShowDigit(self, frame);
+    } else if ((frame->sequence != self->shown_sequence) || (self->phase != self->shown_phase)) {
+        self->shown_sequence = frame->sequence;
+        self->shown_phase = self->phase;
+        self->driver->FrameUpdate(frame->images[self->phase], self->digits);
     }
+}
 
-    self->driver->SegmentsUpdate(segments);
-    self->driver->DigitsTurnOn(self->current_digit);
+int ScreenServiceAdd(screen_t screen) {
+    int result = -1;
+
+    if ((screen != NULL) && (service.count < SCREEN_SERVICE_SCREENS)) {
+        service.screens[service.count++] = screen;
+        ScreenServiceSchedule();
+        result = 0;
+    }
+    return result;
 }
 
+void ScreenServiceRefresh(void) {
+    screen_t screen;
+    const struct screen_frame_s * frame;
+
+    // Las pantallas que se multiplexan por hardware no ocupan turnos, solo llevan la cuenta del parpadeo
+    for (uint8_t index = 0; index < service.count; index++) {
+        if (service.screens[index]->driver->FrameUpdate != NULL) {
+            ScreenRefresh(service.screens[index]);
+        }
+    }
+    if (service.slots_count == 0) {
+        return;
+    }
+
+    if (service.lit != NULL) {
+        service.lit->driver->DigitsTurnOff();
+    }
+    screen = service.screens[service.slots[service.slot]];
+    service.slot++;
+    if (service.slot >= service.slots_count) {
+        service.slot = 0;
+    }
+    frame = &screen->frames[screen->front];
+    ScreenNextDigit(screen, frame);
+    ScreenShowDigit(screen, frame);
+    service.lit = screen;
+}
+
+bool ScreenServiceBlank(void) {
+    for (uint8_t index = 0; index < service.count; index++) {
+        if (service.screens[index]->brightness != 0) {
+            return false;
+        }
+    }
+    return true;
+}
 
 int DisplayFlashDigits(screen_t self, uint8_t from, uint8_t to, uint16_t divisor) {
     int result = 0;
@@ -156,6 +532,7 @@ int DisplayFlashDigits(screen_t self, uint8_t from, uint8_t to, uint16_t divisor
         self->flashing_from = from;
         self->flashing_to = to;
         self->flashing_frequency = 2 * divisor; // Multiplicamos por 2 para tener en cuenta el tiempo de encendido y apagado
+        ScreenPublish(self);
         self->flashing_count = 0;
     }
 
@@ -172,6 +549,7 @@ int DisplayFlashPoints(screen_t self, uint8_t from, uint8_t to, uint16_t divisor
         self->flashing_point_from = from-1;
         self->flashing_point_to = to-1;
         self->flashing_frequency = 2 * divisor;
+        ScreenPublish(self);
         self->flashing_count = 0;
     }
 
@@ -183,12 +561,38 @@ void ScreenSetPoint(screen_t screen, uint8_t digit, bool state) {
     digit = digit-1; // Ajusta el digito para que el digito 1 sea el 0 en el array
     if ((screen != NULL) && (digit < screen->digits)) {
         if (state) {
-            screen->value[digit] |= SEGMENT_P;
+            screen->points |= (1 << digit);
         } else {
-            screen->value[digit] &= ~SEGMENT_P;
+            screen->points &= ~(1 << digit);
         }
+        ScreenPublish(screen);
     }
 }
 
+int ScreenSetBrightness(screen_t self, uint8_t level) {
+    int result = -1;
+
+    if (self != NULL) {
+        self->brightness = level;
+        ScreenPublish(self);
+        result = 0;
+    }
+    return result;
+}
+
+uint8_t ScreenGetBrightness(screen_t self) {
+    return self->brightness;
+}
+
+int ScreenSetDigitBrightness(screen_t self, uint8_t digit, uint8_t level) {
+    int result = -1;
+
+    if ((self != NULL) && (digit < self->digits)) {
+        self->digit_levels[digit] = level;
+        ScreenPublish(self);
+        result = 0;
+    }
+    return result;
+}
 
 /* === End of documentation ======================================================================================== */
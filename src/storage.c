@@ -0,0 +1,268 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file storage.c
+ ** @brief Codigo fuente del módulo de almacenamiento persistente de la configuracion.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "storage.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Marca que identifica el comienzo de un registro
+#define STORAGE_MAGIC     0x5AC3
+
+//! Bytes del CRC que sigue a los datos del registro
+#define STORAGE_CRC_SIZE  2
+
+//! Cantidad maxima de bytes de datos de un registro
+#define STORAGE_DATA_SIZE (STORAGE_PAGE_SIZE - sizeof(struct storage_header_s) - STORAGE_CRC_SIZE)
+
+/* === Private data type declarations ============================================================================== */
+
+//! Encabezado de un registro, al comienzo de la pagina
+struct storage_header_s {
+    uint16_t magic;    // STORAGE_MAGIC
+    uint8_t version;   // version del formato de los datos
+    uint8_t size;      // bytes de datos que siguen al encabezado
+    uint32_t sequence; // numero de registro, crece con cada escritura
+};
+
+struct storage_s {
+    storage_driver_t driver;                    // driver de la memoria
+    scheduler_t scheduler;                      // planificador de la tarea que escribe los cambios
+    scheduler_task_t task;                      // tarea que vence cuando los cambios se asientan
+    uint32_t record[STORAGE_PAGE_SIZE / 4];     // registro que se lee o se escribe, alineado a palabras
+    uint8_t data[STORAGE_DATA_SIZE];            // ultimos datos registrados
+    uint32_t sequence;                          // secuencia del ultimo registro escrito o encontrado
+    uint16_t page;                              // pagina del anillo donde se escribe el proximo registro
+    uint8_t version;                            // version del formato de los datos
+    uint8_t size;                               // bytes de datos
+    bool valid;                                 // indica si data tiene datos guardados o registrados
+    bool dirty;                                 // indica si data tiene cambios que no se escribieron
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el CRC-16/CCITT de un bloque de memoria.
+ *
+ * @param data Datos.
+ * @param size Cantidad de bytes.
+ * @return uint16_t CRC de los datos.
+ */
+static uint16_t StorageCrc(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief Cantidad de bytes de un registro redondeada a palabras, que son los que se leen y se escriben.
+ *
+ * @param self Puntero al almacenamiento.
+ * @return uint16_t Bytes del registro.
+ */
+static uint16_t StorageRecordSize(storage_t self);
+
+/**
+ * @brief Lee una pagina del anillo y verifica que tenga un registro valido del formato actual.
+ *
+ * @param self Puntero al almacenamiento.
+ * @param page Pagina dentro del anillo.
+ * @return bool true si el registro leido en record es valido.
+ */
+static bool StorageReadRecord(storage_t self, uint16_t page);
+
+/**
+ * @brief Escribe los datos registrados en la pagina siguiente del anillo.
+ *
+ * @param self Puntero al almacenamiento.
+ * @return int 0 si se escribieron, -1 si fallo la escritura.
+ */
+static int StorageCommit(storage_t self);
+
+/**
+ * @brief Escribe los cambios cuando se asientan, se ejecuta desde el planificador.
+ *
+ * @param context Puntero al almacenamiento.
+ */
+static void StorageSettled(void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Memoria de la que se toma el unico almacenamiento
+POOL_DEFINE(StorageAllocate, struct storage_s, 1)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t StorageCrc(const uint8_t * data, uint16_t size) {
+    uint16_t crc = 0xFFFF;
+
+    for (uint16_t index = 0; index < size; index++) {
+        crc ^= (uint16_t)data[index] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint16_t StorageRecordSize(storage_t self) {
+    return (sizeof(struct storage_header_s) + self->size + STORAGE_CRC_SIZE + 3) & ~3U;
+}
+
+static bool StorageReadRecord(storage_t self, uint16_t page) {
+    const struct storage_header_s * header = (const struct storage_header_s *)self->record;
+    const uint8_t * bytes = (const uint8_t *)self->record;
+    uint16_t length = sizeof(struct storage_header_s) + self->size;
+    uint16_t crc;
+
+    if (self->driver->Read(STORAGE_FIRST_PAGE + page, self->record, StorageRecordSize(self)) != 0) {
+        return false;
+    }
+    if ((header->magic != STORAGE_MAGIC) || (header->version != self->version) || (header->size != self->size)) {
+        return false;
+    }
+    crc = (uint16_t)(bytes[length] | (bytes[length + 1] << 8));
+    return crc == StorageCrc(bytes, length);
+}
+
+static int StorageCommit(storage_t self) {
+    struct storage_header_s * header = (struct storage_header_s *)self->record;
+    uint8_t * bytes = (uint8_t *)self->record;
+    uint16_t length = sizeof(struct storage_header_s) + self->size;
+    uint16_t crc;
+    int result;
+
+    memset(self->record, 0xFF, sizeof(self->record));
+    header->magic = STORAGE_MAGIC;
+    header->version = self->version;
+    header->size = self->size;
+    header->sequence = self->sequence + 1;
+    memcpy(bytes + sizeof(struct storage_header_s), self->data, self->size);
+    crc = StorageCrc(bytes, length);
+    bytes[length] = (uint8_t)crc;
+    bytes[length + 1] = (uint8_t)(crc >> 8);
+
+    // La pagina avanza aunque la escritura falle, para no insistir sobre una pagina gastada
+    result = self->driver->Write(STORAGE_FIRST_PAGE + self->page, self->record, StorageRecordSize(self));
+    self->page = (self->page + 1) % STORAGE_PAGES;
+    if (result == 0) {
+        self->sequence++;
+        self->dirty = false;
+    }
+    return result;
+}
+
+static void StorageSettled(void * context) {
+    storage_t self = context;
+
+    if (self->dirty && (StorageCommit(self) != 0)) {
+        SchedulerStart(self->scheduler, self->task, STORAGE_SETTLE_MS, 0);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+storage_t StorageCreate(storage_driver_t driver, scheduler_t scheduler, uint8_t version, uint8_t size) {
+    storage_t self = NULL;
+    bool found = false;
+    uint32_t sequence;
+
+    if ((driver == NULL) || (size == 0) || (size > STORAGE_DATA_SIZE)) {
+        return NULL;
+    }
+    self = StorageAllocate();
+    if (self == NULL) {
+        return NULL;
+    }
+    self->task = SchedulerAddTask(scheduler, StorageSettled, self);
+    if (self->task == NULL) {
+        return NULL;
+    }
+    self->driver = driver;
+    self->scheduler = scheduler;
+    self->version = version;
+    self->size = size;
+
+    // El registro mas reciente es el de mayor secuencia, comparada por diferencia por si el contador dio la vuelta
+    for (uint16_t page = 0; page < STORAGE_PAGES; page++) {
+        if (StorageReadRecord(self, page)) {
+            sequence = ((const struct storage_header_s *)self->record)->sequence;
+            if (!found || ((int32_t)(sequence - self->sequence) > 0)) {
+                found = true;
+                self->sequence = sequence;
+                self->page = (page + 1) % STORAGE_PAGES;
+                memcpy(self->data, (const uint8_t *)self->record + sizeof(struct storage_header_s), size);
+            }
+        }
+    }
+    self->valid = found;
+    return self;
+}
+
+int StorageLoad(storage_t self, void * data) {
+    int result = -1;
+
+    if ((self != NULL) && (data != NULL) && self->valid) {
+        memcpy(data, self->data, self->size);
+        result = 0;
+    }
+    return result;
+}
+
+int StorageSave(storage_t self, const void * data) {
+    int result = -1;
+
+    if ((self != NULL) && (data != NULL)) {
+        if (!self->valid || (memcmp(self->data, data, self->size) != 0)) {
+            memcpy(self->data, data, self->size);
+            self->valid = true;
+            self->dirty = true;
+
+            // Cada cambio reinicia la espera, la escritura se hace cuando se dejan de hacer ajustes
+            SchedulerStart(self->scheduler, self->task, STORAGE_SETTLE_MS, 0);
+        }
+        result = 0;
+    }
+    return result;
+}
+
+int StorageFlush(storage_t self) {
+    int result = -1;
+
+    if (self != NULL) {
+        result = 0;
+        if (self->dirty) {
+            SchedulerStop(self->scheduler, self->task);
+            result = StorageCommit(self);
+        }
+    }
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,469 @@
+/*********************************************************************************************************************
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * Copyright (c) 2025, Esteban Ignacio Lobo Silva <nachosilva04.com>
+ * Copyright (c) 2025, Laboratorio de Electronica IV, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file ui.c
+ ** @brief Codigo fuente del módulo de interfaz de usuario del reloj despertador.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "ui.h"
+#include "config.h"
+#include "pool.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de digitos de la hora que se muestran y se configuran (HHMM)
+#define UI_DIGITS         4
+
+//! Digito de la pantalla cuyo punto indica que la alarma esta habilitada, contado desde 1
+#define UI_ALARM_POINT    4
+
+//! Alarma que configura la interfaz
+#define UI_ALARM          0
+
+//! Mensaje que se desplaza al empezar a sonar una alarma, seguido de su hora (HH.MM)
+#define UI_RING_PREFIX    "AL "
+
+//! Texto que se muestra al configurar el dia de la semana, seguido del numero del dia desde 1 para el domingo
+#define UI_WEEKDAY_PREFIX "dIA"
+
+//! Digito de la pantalla que muestra el numero del dia de la semana, contado desde 0
+#define UI_WEEKDAY_DIGIT  (sizeof(UI_WEEKDAY_PREFIX) - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+//! Accion que se ejecuta en una transicion
+typedef void (*ui_action_t)(ui_t self);
+
+//! Celda de la tabla de transiciones
+struct ui_transition_s {
+    ui_action_t action; //!< Accion a ejecutar, NULL si no hay ninguna
+    ui_state_t next;    //!< Estado siguiente, UI_STATE_NONE si no cambia
+};
+
+struct ui_s {
+    clock_bcd_t clock;       // reloj que se muestra y se configura
+    alarms_t alarms;         // alarmas del reloj
+    screen_t screen;         // pantalla donde se muestra la hora
+    ui_state_t state;        // estado actual
+    uint8_t edit[UI_DIGITS]; // hora que se esta configurando, en digitos BCD (HHMM)
+    uint8_t weekday;         // dia de la semana que se esta configurando, 0 es domingo
+    scheduler_t scheduler;   // planificador de los pasos del mensaje que se desplaza
+    scheduler_task_t scroll; // tarea que desplaza el mensaje, activa solo mientras se desplaza
+    uint16_t idle;           // segundos transcurridos desde la ultima tecla o desde que empezo a sonar la alarma
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Muestra la hora actual y el punto que indica si la alarma esta habilitada.
+ *
+ * @param self Puntero a la interfaz.
+ */
+static void UiShowTime(ui_t self);
+
+/**
+ * @brief Muestra la hora mientras suena la alarma, salvo que todavia se este desplazando el mensaje.
+ *
+ * @param self Puntero a la interfaz.
+ */
+static void UiShowRingingTime(ui_t self);
+
+/**
+ * @brief Muestra la hora parpadeando, despues del mensaje de la alarma que suena.
+ *
+ * @param self Puntero a la interfaz.
+ */
+static void UiFlashTime(ui_t self);
+
+/**
+ * @brief Desplaza el mensaje un digito y, cuando termina de salir de la pantalla, pasa a mostrar la hora.
+ *
+ * @param context Puntero a la interfaz.
+ */
+static void UiScrollStep(void * context);
+
+/**
+ * @brief Enciende o apaga todos los puntos decimales de la pantalla.
+ *
+ * @param self Puntero a la interfaz.
+ * @param state true para encenderlos, false para apagarlos.
+ */
+static void UiSetPoints(ui_t self, bool state);
+
+/**
+ * @brief Suma un valor modulo un limite a un numero de dos digitos BCD.
+ *
+ * @param digits Decenas y unidades del numero.
+ * @param delta Valor a sumar, 1 o -1.
+ * @param limit Primer valor fuera del rango, el numero va de 0 a limit - 1.
+ */
+static void UiAdjust(uint8_t digits[2], int8_t delta, uint8_t limit);
+
+/**
+ * @brief Muestra el dia de la semana que se esta configurando.
+ *
+ * @param self Puntero a la interfaz.
+ */
+static void UiShowWeekday(ui_t self);
+
+static void UiLoadTime(ui_t self);
+static void UiLoadAlarm(ui_t self);
+static void UiIncrementMinutes(ui_t self);
+static void UiDecrementMinutes(ui_t self);
+static void UiIncrementHours(ui_t self);
+static void UiDecrementHours(ui_t self);
+static void UiIncrementWeekday(ui_t self);
+static void UiDecrementWeekday(ui_t self);
+static void UiCommitTime(ui_t self);
+static void UiCommitAlarm(ui_t self);
+static void UiEnableAlarm(ui_t self);
+static void UiDisableAlarm(ui_t self);
+static void UiSnooze(ui_t self);
+static void UiStop(ui_t self);
+
+static void UiEnterShowTime(ui_t self);
+static void UiEnterSetMinutes(ui_t self);
+static void UiEnterSetHours(ui_t self);
+static void UiEnterSetWeekday(ui_t self);
+static void UiEnterSetAlarmMinutes(ui_t self);
+static void UiEnterRinging(ui_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Accion y estado siguiente para cada estado y evento, las celdas que no aparecen ignoran el evento
+static const struct ui_transition_s TRANSITIONS[UI_STATES_COUNT][UI_EVENTS_COUNT] = {
+    [UI_SHOW_TIME] = {
+        [UI_EVENT_SET_TIME] = {UiLoadTime, UI_SET_TIME_MINUTES},
+        [UI_EVENT_SET_ALARM] = {UiLoadAlarm, UI_SET_ALARM_MINUTES},
+        [UI_EVENT_ACCEPT] = {UiEnableAlarm, UI_STATE_NONE},
+        [UI_EVENT_CANCEL] = {UiDisableAlarm, UI_STATE_NONE},
+        [UI_EVENT_SECOND] = {UiShowTime, UI_STATE_NONE},
+        [UI_EVENT_ALARM] = {NULL, UI_RINGING},
+    },
+    [UI_SET_TIME_MINUTES] = {
+        [UI_EVENT_INCREMENT] = {UiIncrementMinutes, UI_STATE_NONE},
+        [UI_EVENT_DECREMENT] = {UiDecrementMinutes, UI_STATE_NONE},
+        [UI_EVENT_ACCEPT] = {NULL, UI_SET_TIME_HOURS},
+        [UI_EVENT_CANCEL] = {NULL, UI_SHOW_TIME},
+        [UI_EVENT_ALARM] = {NULL, UI_RINGING},
+        [UI_EVENT_TIMEOUT] = {NULL, UI_SHOW_TIME},
+    },
+    [UI_SET_TIME_HOURS] = {
+        [UI_EVENT_INCREMENT] = {UiIncrementHours, UI_STATE_NONE},
+        [UI_EVENT_DECREMENT] = {UiDecrementHours, UI_STATE_NONE},
+        [UI_EVENT_ACCEPT] = {NULL, UI_SET_TIME_WEEKDAY},
+        [UI_EVENT_CANCEL] = {NULL, UI_SHOW_TIME},
+        [UI_EVENT_ALARM] = {NULL, UI_RINGING},
+        [UI_EVENT_TIMEOUT] = {NULL, UI_SHOW_TIME},
+    },
+    [UI_SET_TIME_WEEKDAY] = {
+        [UI_EVENT_INCREMENT] = {UiIncrementWeekday, UI_STATE_NONE},
+        [UI_EVENT_DECREMENT] = {UiDecrementWeekday, UI_STATE_NONE},
+        [UI_EVENT_ACCEPT] = {UiCommitTime, UI_SHOW_TIME},
+        [UI_EVENT_CANCEL] = {NULL, UI_SHOW_TIME},
+        [UI_EVENT_ALARM] = {NULL, UI_RINGING},
+        [UI_EVENT_TIMEOUT] = {NULL, UI_SHOW_TIME},
+    },
+    [UI_SET_ALARM_MINUTES] = {
+        [UI_EVENT_INCREMENT] = {UiIncrementMinutes, UI_STATE_NONE},
+        [UI_EVENT_DECREMENT] = {UiDecrementMinutes, UI_STATE_NONE},
+        [UI_EVENT_ACCEPT] = {NULL, UI_SET_ALARM_HOURS},
+        [UI_EVENT_CANCEL] = {NULL, UI_SHOW_TIME},
+        [UI_EVENT_ALARM] = {NULL, UI_RINGING},
+        [UI_EVENT_TIMEOUT] = {NULL, UI_SHOW_TIME},
+    },
+    [UI_SET_ALARM_HOURS] = {
+        [UI_EVENT_INCREMENT] = {UiIncrementHours, UI_STATE_NONE},
+        [UI_EVENT_DECREMENT] = {UiDecrementHours, UI_STATE_NONE},
+        [UI_EVENT_ACCEPT] = {UiCommitAlarm, UI_SHOW_TIME},
+        [UI_EVENT_CANCEL] = {NULL, UI_SHOW_TIME},
+        [UI_EVENT_ALARM] = {NULL, UI_RINGING},
+        [UI_EVENT_TIMEOUT] = {NULL, UI_SHOW_TIME},
+    },
+    [UI_RINGING] = {
+        [UI_EVENT_SET_ALARM] = {UiSnooze, UI_SHOW_TIME},
+        [UI_EVENT_ACCEPT] = {UiSnooze, UI_SHOW_TIME},
+        [UI_EVENT_CANCEL] = {UiStop, UI_SHOW_TIME},
+        [UI_EVENT_SECOND] = {UiShowRingingTime, UI_STATE_NONE},
+        [UI_EVENT_TIMEOUT] = {UiStop, UI_SHOW_TIME},
+    },
+};
+
+//! Accion que se ejecuta al entrar en cada estado, prepara la pantalla
+static const ui_action_t ENTER[UI_STATES_COUNT] = {
+    [UI_SHOW_TIME] = UiEnterShowTime,
+    [UI_SET_TIME_MINUTES] = UiEnterSetMinutes,
+    [UI_SET_TIME_HOURS] = UiEnterSetHours,
+    [UI_SET_TIME_WEEKDAY] = UiEnterSetWeekday,
+    [UI_SET_ALARM_MINUTES] = UiEnterSetAlarmMinutes,
+    [UI_SET_ALARM_HOURS] = UiEnterSetHours,
+    [UI_RINGING] = UiEnterRinging,
+};
+
+//! Memoria de la que se toma la unica interfaz
+POOL_DEFINE(UiAllocate, struct ui_s, 1)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void UiShowTime(ui_t self) {
+    alarm_config_t alarm;
+
+    ClockDisplay(self->clock, self->screen);
+    AlarmsGet(self->alarms, UI_ALARM, &alarm);
+    ScreenSetPoint(self->screen, UI_ALARM_POINT, alarm.enabled);
+}
+
+static void UiShowRingingTime(ui_t self) {
+    if (!SchedulerIsActive(self->scroll)) {
+        UiShowTime(self);
+    }
+}
+
+static void UiFlashTime(ui_t self) {
+    UiShowTime(self);
+    DisplayFlashDigits(self->screen, 0, UI_DIGITS - 1, UI_FLASH_SCANS);
+}
+
+static void UiScrollStep(void * context) {
+    ui_t self = context;
+
+    if (ScreenScrollStep(self->screen)) {
+        SchedulerStop(self->scheduler, self->scroll);
+        UiFlashTime(self);
+    }
+}
+
+static void UiSetPoints(ui_t self, bool state) {
+    for (uint8_t digit = 1; digit <= UI_DIGITS; digit++) {
+        ScreenSetPoint(self->screen, digit, state);
+    }
+}
+
+static void UiAdjust(uint8_t digits[2], int8_t delta, uint8_t limit) {
+    int8_t value = digits[0] * 10 + digits[1] + delta;
+
+    if (value < 0) {
+        value = limit - 1;
+    } else if (value >= limit) {
+        value = 0;
+    }
+    digits[0] = value / 10;
+    digits[1] = value % 10;
+}
+
+static void UiShowWeekday(ui_t self) {
+    char text[] = UI_WEEKDAY_PREFIX "1";
+
+    text[UI_WEEKDAY_DIGIT] += self->weekday;
+    ScreenWriteString(self->screen, text);
+}
+
+static void UiLoadTime(ui_t self) {
+    clock_time_t now;
+
+    ClockGetTime(self->clock, &now);
+    memcpy(self->edit, now.bcd, UI_DIGITS);
+    self->weekday = ClockGetWeekday(self->clock);
+}
+
+static void UiLoadAlarm(ui_t self) {
+    alarm_config_t alarm;
+
+    AlarmsGet(self->alarms, UI_ALARM, &alarm);
+    memcpy(self->edit, alarm.time, UI_DIGITS);
+}
+
+static void UiIncrementMinutes(ui_t self) {
+    UiAdjust(&self->edit[2], 1, 60);
+    ScreenWriteBCD(self->screen, self->edit, UI_DIGITS);
+}
+
+static void UiDecrementMinutes(ui_t self) {
+    UiAdjust(&self->edit[2], -1, 60);
+    ScreenWriteBCD(self->screen, self->edit, UI_DIGITS);
+}
+
+static void UiIncrementHours(ui_t self) {
+    UiAdjust(&self->edit[0], 1, 24);
+    ScreenWriteBCD(self->screen, self->edit, UI_DIGITS);
+}
+
+static void UiDecrementHours(ui_t self) {
+    UiAdjust(&self->edit[0], -1, 24);
+    ScreenWriteBCD(self->screen, self->edit, UI_DIGITS);
+}
+
+static void UiIncrementWeekday(ui_t self) {
+    self->weekday = (self->weekday + 1) % CLOCK_WEEKDAYS;
+    UiShowWeekday(self);
+}
+
+static void UiDecrementWeekday(ui_t self) {
+    self->weekday = (self->weekday + CLOCK_WEEKDAYS - 1) % CLOCK_WEEKDAYS;
+    UiShowWeekday(self);
+}
+
+static void UiCommitTime(ui_t self) {
+    clock_time_t time = {0};
+
+    memcpy(time.bcd, self->edit, UI_DIGITS);
+    ClockSetTime(self->clock, &time);
+    ClockSetWeekday(self->clock, self->weekday);
+    AlarmsSetTime(self->alarms, self->weekday, time.bcd);
+}
+
+static void UiCommitAlarm(ui_t self) {
+    alarm_config_t alarm;
+
+    AlarmsGet(self->alarms, UI_ALARM, &alarm);
+    memcpy(alarm.time, self->edit, UI_DIGITS);
+    alarm.enabled = true;
+    AlarmsSet(self->alarms, UI_ALARM, &alarm);
+}
+
+static void UiEnableAlarm(ui_t self) {
+    AlarmsEnable(self->alarms, UI_ALARM, true);
+    ScreenSetPoint(self->screen, UI_ALARM_POINT, true);
+}
+
+static void UiDisableAlarm(ui_t self) {
+    AlarmsEnable(self->alarms, UI_ALARM, false);
+    ScreenSetPoint(self->screen, UI_ALARM_POINT, false);
+}
+
+static void UiSnooze(ui_t self) {
+    AlarmsSnooze(self->alarms);
+}
+
+static void UiStop(ui_t self) {
+    AlarmsStop(self->alarms);
+}
+
+static void UiEnterShowTime(ui_t self) {
+    SchedulerStop(self->scheduler, self->scroll);
+    DisplayFlashDigits(self->screen, 0, UI_DIGITS - 1, 0);
+    UiSetPoints(self, false);
+    UiShowTime(self);
+}
+
+static void UiEnterSetMinutes(ui_t self) {
+    ScreenWriteBCD(self->screen, self->edit, UI_DIGITS);
+    DisplayFlashDigits(self->screen, 2, 3, UI_FLASH_SCANS);
+}
+
+static void UiEnterSetHours(ui_t self) {
+    DisplayFlashDigits(self->screen, 0, 1, UI_FLASH_SCANS);
+}
+
+static void UiEnterSetWeekday(ui_t self) {
+    UiShowWeekday(self);
+    DisplayFlashDigits(self->screen, UI_WEEKDAY_DIGIT, UI_WEEKDAY_DIGIT, UI_FLASH_SCANS);
+}
+
+static void UiEnterSetAlarmMinutes(ui_t self) {
+    UiEnterSetMinutes(self);
+    UiSetPoints(self, true);
+}
+
+static void UiEnterRinging(ui_t self) {
+    alarm_config_t alarm;
+    uint8_t index = AlarmsRinging(self->alarms);
+    char text[] = UI_RING_PREFIX "00.00";
+    char * time = &text[sizeof(UI_RING_PREFIX) - 1];
+
+    // El tiempo que suena la alarma se cuenta desde que empieza, aunque hayan pasado muchos segundos sin teclas
+    self->idle = 0;
+    DisplayFlashDigits(self->screen, 0, UI_DIGITS - 1, 0);
+    UiSetPoints(self, false);
+
+    AlarmsGet(self->alarms, (index != ALARM_NONE) ? index : UI_ALARM, &alarm);
+    time[0] += alarm.time[0];
+    time[1] += alarm.time[1];
+    time[3] += alarm.time[2];
+    time[4] += alarm.time[3];
+    if ((ScreenScrollString(self->screen, text) != 0) ||
+        (SchedulerStart(self->scheduler, self->scroll, UI_SCROLL_STEP_MS, UI_SCROLL_STEP_MS) != 0)) {
+        UiFlashTime(self);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+ui_t UiCreate(clock_bcd_t clock, alarms_t alarms, screen_t screen, scheduler_t scheduler) {
+    ui_t self = UiAllocate();
+
+    if (self != NULL) {
+        self->clock = clock;
+        self->alarms = alarms;
+        self->screen = screen;
+        self->scheduler = scheduler;
+        self->scroll = SchedulerAddTask(scheduler, UiScrollStep, self);
+        self->state = UI_SHOW_TIME;
+        UiEnterShowTime(self);
+    }
+    return self;
+}
+
+void UiHandleEvent(ui_t self, ui_event_t event) {
+    const struct ui_transition_s * transition;
+    uint16_t timeout;
+
+    if (event >= UI_EVENTS_COUNT) {
+        return;
+    }
+
+    // El tiempo sin teclas se cuenta aca para que la tabla solo tenga que decidir que hacer con el evento de timeout,
+    // la cuenta se detiene al llegar al limite para que el evento se genere una sola vez
+    if (event == UI_EVENT_SECOND) {
+        timeout = (self->state == UI_RINGING) ? UI_RING_TIMEOUT_SECONDS : UI_TIMEOUT_SECONDS;
+        if (self->idle < timeout) {
+            self->idle++;
+            if (self->idle == timeout) {
+                UiHandleEvent(self, UI_EVENT_TIMEOUT);
+            }
+        }
+    } else if (event < UI_EVENT_SECOND) {
+        // Los eventos de teclas estan antes que el del segundo en ui_event_t
+        self->idle = 0;
+    }
+
+    transition = &TRANSITIONS[self->state][event];
+    if (transition->action != NULL) {
+        transition->action(self);
+    }
+    if (transition->next != UI_STATE_NONE) {
+        self->state = transition->next;
+        ENTER[self->state](self);
+    }
+}
+
+ui_state_t UiGetState(ui_t self) {
+    return self->state;
+}
+
+/* === End of documentation ======================================================================================== */